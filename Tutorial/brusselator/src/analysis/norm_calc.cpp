@@ -12,8 +12,10 @@
 #include <stdexcept>
 #include <cstdint>
 #include <cmath>
-#include <thread>
+#include <string>
+#include <vector>
 #include "adios2.h"
+#include "../../../gray-scott/common/step_wait.hpp"
 
 /*
  * Function to compute the norm of a vector
@@ -41,7 +43,10 @@ void printUsage()
         << "Usage: analysis input_filename output_filename [output_inputdata]\n"
         << "  input_filename:   Name of the input file handle for reading data\n"
         << "  output_filename:  Name of the output file to which data must be written\n"
-        << "  output_inputdata: Enter 0 if you want to write the original variables besides the analysis results\n\n";
+        << "  output_inputdata: Enter 0 if you want to write the original variables besides the analysis results\n"
+        << "  --wait=I[:M[:F[:G]]]: BeginStep timeout starts at I seconds and grows by F up to M\n"
+        << "                    while the next step is not ready, give up after G seconds,\n"
+        << "                    default = 0.1:10:2:-1 (never)\n\n";
 }
 
 /*
@@ -61,7 +66,16 @@ int main(int argc, char *argv[])
     MPI_Comm_rank(comm, &rank);
     MPI_Comm_size(comm, &comm_size);
 
-    if (argc < 3)
+    // --wait=... can be anywhere, the rest are the positional arguments
+    WaitPolicy wait_policy;
+    std::vector<std::string> args;
+    for (int i = 1; i < argc; i++)
+    {
+        if (!parse_wait_option(argv[i], wait_policy))
+            args.push_back(argv[i]);
+    }
+
+    if (args.size() < 2)
     {
         std::cout << "Not enough arguments\n";
         if (rank == 0)
@@ -72,11 +86,11 @@ int main(int argc, char *argv[])
     std::string in_filename;
     std::string out_filename;
     bool write_norms_only = true;
-    in_filename = argv[1];
-    out_filename = argv[2];
-    if (argc >= 4)
+    in_filename = args[0];
+    out_filename = args[1];
+    if (args.size() >= 3)
     {
-        std::string out_norms_only = argv[3];
+        std::string out_norms_only = args[2];
         if (out_norms_only.compare("0") == 0)
             write_norms_only = false;
     }
@@ -117,24 +131,19 @@ int main(int argc, char *argv[])
     adios2::Engine writer_engine = writer_io.Open(out_filename, adios2::Mode::Write, comm);
 
     // read data per timestep
+    StepWaiter waiter(wait_policy, comm);
     while(true) {
 
-        // Begin step
-        adios2::StepStatus read_status = reader_engine.BeginStep(adios2::StepMode::Read, 10.0f);
-        if (read_status == adios2::StepStatus::NotReady)
-        {
-            // std::cout << "Stream not ready yet. Waiting...\n";
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            continue;
-        }
-        else if (read_status != adios2::StepStatus::OK)
+        // Begin step, the engine blocks until the step is ready
+        adios2::StepStatus read_status = waiter.begin_step(reader_engine);
+        if (read_status != adios2::StepStatus::OK)
         {
             break;
         }
  
         step_num ++;
         if (rank == 0)
-            std::cout << "Step: " << step_num << std::endl;
+            std::cout << "Step: " << step_num << ", waited " << waiter.last_wait() << " s" << std::endl;
 
         // Inquire variable and set the selection at the first step only
         // This assumes that the variable dimensions do not change across timesteps
@@ -232,6 +241,8 @@ int main(int argc, char *argv[])
     // cleanup
     reader_engine.Close();
     writer_engine.Close();
+    if (rank == 0)
+        waiter.print_summary(std::cout, "Analysis");
     MPI_Finalize();
     return 0;
 }
@@ -0,0 +1,1083 @@
+/*
+ * Analysis host for the Gray-Scott simulation.
+ * Reads U and V once per step and runs a chain of analyses (stages) on the
+ * same buffers in one process, configured in a JSON file. Each stage has its
+ * own worker thread and its own output IO and engine. The stages of a step
+ * compute concurrently on their workers, then the host thread does the
+ * reductions and writes of the stages one after the other, so only the host
+ * thread and the reader use MPI.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <adios2.h>
+#include <mpi.h>
+
+#include "../common/step_reader.hpp"
+#include "../simulation/json.hpp"
+#include "isosurface.hpp"
+#include "pdf.hpp"
+
+#ifdef USE_VTK
+#include <vtkConnectivityFilter.h>
+
+#include "../common/vtk_mesh.hpp"
+#include "blob_stats.hpp"
+#endif
+
+/*
+ * U and V of one step in a slab of this process, shared by all stages.
+ * The slab has the nslices slices of this process and, if a stage needs it,
+ * one more slice of the next process.
+ */
+struct HostStep
+{
+    adios2::Dims shape;
+    adios2::Dims start;
+    adios2::Dims count; // with the extra slice
+    size_t nslices = 0;
+    std::vector<double> u;
+    std::vector<double> v;
+    bool have_minmax = false; // global min/max
+    std::pair<double, double> minmax_u;
+    std::pair<double, double> minmax_v;
+    int sim_step = 0;
+
+    // values of the own slices
+    size_t size() const { return nslices * count[1] * count[2]; }
+};
+
+/*
+ * Runs fn(begin, end, t) on nthreads contiguous parts t of [0, n)
+ */
+template <class F>
+void parallel_for(const size_t n, int nthreads, F fn)
+{
+    nthreads = std::max(1, nthreads);
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nthreads; ++t)
+    {
+        threads.emplace_back(fn, n * t / nthreads, n * (t + 1) / nthreads, t);
+    }
+    fn(0, n / nthreads, 0);
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+}
+
+/*
+ * One analysis of the host. compute() runs on the worker thread of the stage
+ * and must not call MPI, write() runs on the host thread after all stages
+ * computed the step. The worker is kept for all steps; with "threads" > 1
+ * the kernels (parallel_for, compute_pdf, MarchingCubes) start their extra
+ * threads on each call, which is cheap next to a step.
+ */
+class Stage
+{
+public:
+    Stage(const nlohmann::json &conf, adios2::IO io, MPI_Comm comm)
+    : name(conf.value("name", conf.at("type").get<std::string>())),
+      threads(std::max(1, conf.value("threads", 1))), io(io), comm(comm)
+    {
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &nproc);
+        engine = this->io.Open(conf.at("output").get<std::string>(),
+                               adios2::Mode::Write, comm);
+    }
+    virtual ~Stage() {}
+
+    virtual bool needs_v() const { return true; }
+    virtual bool needs_next_slice() const { return false; }
+    virtual bool needs_minmax() const { return false; }
+
+    virtual void compute(const HostStep &in) = 0;
+    virtual void write(const HostStep &in) = 0;
+
+    virtual void close() { engine.Close(); }
+
+    const std::string name;
+    double compute_time = 0.0;
+    double write_time = 0.0;
+
+protected:
+    int threads;
+    adios2::IO io;
+    adios2::Engine engine;
+    MPI_Comm comm;
+    int rank, nproc;
+    bool first_step = true;
+};
+
+/*
+ * PDFs of the slices of U and V, the same output as pdf_calc
+ */
+class PdfStage : public Stage
+{
+public:
+    PdfStage(const nlohmann::json &conf, adios2::IO io, MPI_Comm comm)
+    : Stage(conf, io, comm)
+    {
+        const int n = conf.value("bins", 1000);
+        if (n < 1)
+        {
+            throw std::invalid_argument("ERROR: pdf needs bins > 0\n");
+        }
+        nbins = static_cast<size_t>(n);
+    }
+
+    bool needs_minmax() const override { return true; }
+
+    void compute(const HostStep &in) override
+    {
+        const size_t slice_size = in.count[1] * in.count[2];
+        const std::vector<double> *data[2] = {&in.u, &in.v};
+        const std::pair<double, double> *mm[2] = {&in.minmax_u, &in.minmax_v};
+        for (int j = 0; j < 2; ++j)
+        {
+            std::vector<uint64_t> counts(in.nslices * nbins, 0);
+            compute_pdf(data[j]->data(), in.nslices, slice_size, nbins,
+                        mm[j]->first, mm[j]->second, counts.data(), threads);
+            pdf[j].assign(counts.begin(), counts.end());
+            compute_bins(nbins, mm[j]->first, mm[j]->second, bins[j]);
+        }
+    }
+
+    void write(const HostStep &in) override
+    {
+        if (first_step)
+        {
+            const char *names[2] = {"U", "V"};
+            for (int j = 0; j < 2; ++j)
+            {
+                const std::string n = names[j];
+                var_pdf[j] = io.DefineVariable<double>(
+                    n + "/pdf", {in.shape[0], nbins}, {in.start[0], 0},
+                    {in.nslices, nbins});
+                if (!rank)
+                {
+                    var_bins[j] = io.DefineVariable<double>(
+                        n + "/bins", {nbins}, {0}, {nbins});
+                }
+            }
+            if (!rank)
+            {
+                var_step = io.DefineVariable<int>("step");
+            }
+            first_step = false;
+        }
+
+        engine.BeginStep();
+        for (int j = 0; j < 2; ++j)
+        {
+            if (in.nslices)
+            {
+                engine.Put<double>(var_pdf[j], pdf[j].data());
+            }
+            if (!rank)
+            {
+                engine.Put<double>(var_bins[j], bins[j].data());
+            }
+        }
+        if (!rank)
+        {
+            engine.Put<int>(var_step, in.sim_step);
+        }
+        engine.EndStep();
+    }
+
+private:
+    size_t nbins;
+    std::vector<double> pdf[2];
+    std::vector<double> bins[2];
+    adios2::Variable<double> var_pdf[2], var_bins[2];
+    adios2::Variable<int> var_step;
+};
+
+/*
+ * L1, L2 and max norms of U and V
+ */
+class NormStage : public Stage
+{
+public:
+    NormStage(const nlohmann::json &conf, adios2::IO io, MPI_Comm comm)
+    : Stage(conf, io, comm)
+    {
+    }
+
+    void compute(const HostStep &in) override
+    {
+        const std::vector<double> *data[2] = {&in.u, &in.v};
+        for (int j = 0; j < 2; ++j)
+        {
+            const double *x = data[j]->data();
+            std::vector<double> part(3 * threads, 0.0);
+            parallel_for(in.size(), threads,
+                         [&](size_t begin, size_t end, int t) {
+                             double l1 = 0.0, l2 = 0.0, linf = 0.0;
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 const double a = std::abs(x[i]);
+                                 l1 += a;
+                                 l2 += a * a;
+                                 linf = std::max(linf, a);
+                             }
+                             part[3 * t] = l1;
+                             part[3 * t + 1] = l2;
+                             part[3 * t + 2] = linf;
+                         });
+            sums[j][0] = sums[j][1] = maxs[j] = 0.0;
+            for (int t = 0; t < threads; ++t)
+            {
+                sums[j][0] += part[3 * t];
+                sums[j][1] += part[3 * t + 1];
+                maxs[j] = std::max(maxs[j], part[3 * t + 2]);
+            }
+        }
+    }
+
+    void write(const HostStep &in) override
+    {
+        double s[4] = {sums[0][0], sums[0][1], sums[1][0], sums[1][1]};
+        double gs[4], gmax[2];
+        MPI_Reduce(s, gs, 4, MPI_DOUBLE, MPI_SUM, 0, comm);
+        MPI_Reduce(maxs, gmax, 2, MPI_DOUBLE, MPI_MAX, 0, comm);
+
+        if (first_step)
+        {
+            if (!rank)
+            {
+                var_norm[0] = io.DefineVariable<double>("U/norm", {3}, {0}, {3});
+                var_norm[1] = io.DefineVariable<double>("V/norm", {3}, {0}, {3});
+                var_step = io.DefineVariable<int>("step");
+                io.DefineAttribute<std::string>("description",
+                                                "L1, L2 and max norm",
+                                                "U/norm");
+                io.DefineAttribute<std::string>("description",
+                                                "L1, L2 and max norm",
+                                                "V/norm");
+            }
+            first_step = false;
+        }
+
+        engine.BeginStep();
+        if (!rank)
+        {
+            for (int j = 0; j < 2; ++j)
+            {
+                norms[j][0] = gs[2 * j];
+                norms[j][1] = std::sqrt(gs[2 * j + 1]);
+                norms[j][2] = gmax[j];
+                engine.Put<double>(var_norm[j], norms[j]);
+            }
+            engine.Put<int>(var_step, in.sim_step);
+        }
+        engine.EndStep();
+    }
+
+private:
+    double sums[2][2];
+    double maxs[2];
+    double norms[2][3];
+    adios2::Variable<double> var_norm[2];
+    adios2::Variable<int> var_step;
+};
+
+/*
+ * Min, max, mean and variance of U and V
+ */
+class ReduceStage : public Stage
+{
+public:
+    ReduceStage(const nlohmann::json &conf, adios2::IO io, MPI_Comm comm)
+    : Stage(conf, io, comm)
+    {
+    }
+
+    void compute(const HostStep &in) override
+    {
+        const std::vector<double> *data[2] = {&in.u, &in.v};
+        for (int j = 0; j < 2; ++j)
+        {
+            const double *x = data[j]->data();
+            std::vector<Moments> part(threads);
+            parallel_for(in.size(), threads,
+                         [&](size_t begin, size_t end, int t) {
+                             Moments m;
+                             for (size_t i = begin; i < end; ++i)
+                             {
+                                 m.add(x[i]);
+                             }
+                             part[t] = m;
+                         });
+            local[j] = Moments();
+            for (const auto &m : part)
+            {
+                local[j].merge(m);
+            }
+        }
+    }
+
+    void write(const HostStep &in) override
+    {
+        // the moments of all processes, merged on process 0
+        std::vector<Moments> all(rank ? 0 : 2 * nproc);
+        MPI_Gather(local, 2 * sizeof(Moments), MPI_BYTE, all.data(),
+                   2 * sizeof(Moments), MPI_BYTE, 0, comm);
+
+        if (first_step)
+        {
+            if (!rank)
+            {
+                const char *names[2] = {"U", "V"};
+                for (int j = 0; j < 2; ++j)
+                {
+                    const std::string n = names[j];
+                    var_min[j] = io.DefineVariable<double>(n + "/min");
+                    var_max[j] = io.DefineVariable<double>(n + "/max");
+                    var_mean[j] = io.DefineVariable<double>(n + "/mean");
+                    var_variance[j] =
+                        io.DefineVariable<double>(n + "/variance");
+                }
+                var_step = io.DefineVariable<int>("step");
+            }
+            first_step = false;
+        }
+
+        engine.BeginStep();
+        if (!rank)
+        {
+            for (int j = 0; j < 2; ++j)
+            {
+                Moments m;
+                for (int r = 0; r < nproc; ++r)
+                {
+                    m.merge(all[2 * r + j]);
+                }
+                engine.Put<double>(var_min[j], m.min);
+                engine.Put<double>(var_max[j], m.max);
+                engine.Put<double>(var_mean[j], m.mean);
+                engine.Put<double>(var_variance[j],
+                                   m.n > 1 ? m.m2 / (m.n - 1) : 0.0);
+            }
+            engine.Put<int>(var_step, in.sim_step);
+        }
+        engine.EndStep();
+    }
+
+private:
+    // count, min, max, mean and sum of squared differences, mergeable
+    struct Moments
+    {
+        double n = 0.0;
+        double min = std::numeric_limits<double>::max();
+        double max = std::numeric_limits<double>::lowest();
+        double mean = 0.0;
+        double m2 = 0.0;
+
+        void add(const double x)
+        {
+            n += 1.0;
+            min = std::min(min, x);
+            max = std::max(max, x);
+            const double delta = x - mean;
+            mean += delta / n;
+            m2 += delta * (x - mean);
+        }
+
+        void merge(const Moments &o)
+        {
+            if (!o.n)
+            {
+                return;
+            }
+            const double total = n + o.n;
+            const double delta = o.mean - mean;
+            mean += delta * o.n / total;
+            m2 += o.m2 + delta * delta * n * o.n / total;
+            n = total;
+            min = std::min(min, o.min);
+            max = std::max(max, o.max);
+        }
+    };
+
+    Moments local[2];
+    adios2::Variable<double> var_min[2], var_max[2], var_mean[2],
+        var_variance[2];
+    adios2::Variable<int> var_step;
+};
+
+/*
+ * Isosurfaces of U, the same output as isosurface, extracted with the
+ * threads of the stage.
+ */
+class IsosurfaceStage : public Stage
+{
+public:
+    IsosurfaceStage(const nlohmann::json &conf, adios2::IO io, MPI_Comm comm)
+    : Stage(conf, io, comm),
+      isovalues(conf.at("isovalues").get<std::vector<double>>()),
+      out(this->io, compact_encoding(conf), lod_sizes(conf))
+    {
+        if (isovalues.empty())
+        {
+            throw std::invalid_argument(
+                "ERROR: isosurface needs at least one isovalue\n");
+        }
+    }
+
+    bool needs_v() const override { return false; }
+    bool needs_next_slice() const override { return true; }
+
+    void compute(const HostStep &in) override
+    {
+        MarchingCubes<double> mc(in.start, in.count, in.u.data(), isovalues,
+                                 threads);
+        mesh.points.resize(3 * mc.npoints());
+        mesh.normals.resize(3 * mc.npoints());
+        mesh.cells.resize(3 * mc.ncells());
+        mesh.first_point = mc.first_point();
+        mesh.first_cell = mc.first_cell();
+        mc.extract(mesh.points.data(), mesh.normals.data(), mesh.cells.data());
+
+        // the vertices in the next slice belong to the next process
+        weld.clear();
+        weld_part(weld, mc, {in.start, {in.nslices, in.count[1], in.count[2]}},
+                  in.shape);
+    }
+
+    void write(const HostStep &in) override
+    {
+        write_mesh(engine, mesh, weld, out, in.sim_step, comm);
+    }
+
+    // mesh of this process, only its own vertices and the cells referring
+    // to all points after write()
+    Mesh mesh;
+
+private:
+    std::vector<double> isovalues;
+    Weld weld;
+    MeshOutput out;
+
+    static bool compact_encoding(const nlohmann::json &conf)
+    {
+        const std::string encoding = conf.value("encoding", "plain");
+        if (encoding != "plain" && encoding != "compact")
+        {
+            throw std::invalid_argument(
+                "ERROR: unknown isosurface encoding " + encoding + "\n");
+        }
+        return encoding == "compact";
+    }
+
+    static std::vector<int> lod_sizes(const nlohmann::json &conf)
+    {
+        const auto sizes = conf.value("lod", std::vector<int>());
+        for (int size : sizes)
+        {
+            if (size < 1)
+            {
+                throw std::invalid_argument(
+                    "ERROR: the cluster sizes of lod must be >= 1\n");
+            }
+        }
+        return sizes;
+    }
+};
+
+#ifdef USE_VTK
+/*
+ * Connected components of the mesh of an isosurface stage and their surface
+ * areas, as find_blobs. write() gathers the mesh of the step on process 0,
+ * and the VTK pass runs in the next compute(), on the worker of the stage
+ * and concurrently with the other stages; so the blobs of a step are written
+ * with the next step, and those of the last step at close.
+ */
+class BlobsStage : public Stage
+{
+public:
+    BlobsStage(const nlohmann::json &conf, adios2::IO io, MPI_Comm comm,
+               const IsosurfaceStage *iso)
+    : Stage(conf, io, comm), iso(iso)
+    {
+    }
+
+    bool needs_v() const override { return false; }
+
+    void compute(const HostStep &) override { find_blobs(); }
+
+    void write(const HostStep &in) override
+    {
+        put_blobs();
+        gather(iso->mesh.points, vtkMesh.points);
+        gather(iso->mesh.cells, vtkMesh.cells);
+        mesh_step = in.sim_step;
+        have_mesh = true;
+    }
+
+    void close() override
+    {
+        find_blobs();
+        put_blobs();
+        Stage::close();
+    }
+
+private:
+    const IsosurfaceStage *iso;
+    adios2::Variable<int> var_nblobs;
+    adios2::Variable<double> var_area;
+    adios2::Variable<double> var_volume;
+    adios2::Variable<int> var_step;
+
+    // the gathered mesh, reused for all steps
+    VtkMesh vtkMesh;
+    bool have_mesh = false;
+    int mesh_step = 0;
+
+    // the blobs found in it, on process 0
+    std::vector<double> areas, volumes;
+    bool have_blobs = false;
+    int blobs_step = 0;
+
+    // arrays of all processes on process 0, in the order of the ranks
+    template <class T>
+    void gather(const std::vector<T> &local, std::vector<T> &all)
+    {
+        const MPI_Datatype type =
+            std::is_same<T, int>::value ? MPI_INT : MPI_DOUBLE;
+        int n = static_cast<int>(local.size());
+        std::vector<int> counts(nproc), displs(nproc, 0);
+        MPI_Gather(&n, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, comm);
+        for (int r = 1; r < nproc; ++r)
+        {
+            displs[r] = displs[r - 1] + counts[r - 1];
+        }
+        all.resize(rank ? 0 : displs[nproc - 1] + counts[nproc - 1]);
+        MPI_Gatherv(local.data(), n, type, all.data(), counts.data(),
+                    displs.data(), type, 0, comm);
+    }
+
+    // the blobs of the gathered mesh, no MPI
+    void find_blobs()
+    {
+        if (!have_mesh)
+        {
+            return;
+        }
+        areas.clear();
+        volumes.clear();
+        if (!vtkMesh.cells.empty())
+        {
+            auto connectivityFilter =
+                vtkSmartPointer<vtkConnectivityFilter>::New();
+            connectivityFilter->SetInputData(vtkMesh.poly_data());
+            connectivityFilter->SetExtractionModeToAllRegions();
+            connectivityFilter->ColorRegionsOn();
+            connectivityFilter->Update();
+            for (const auto &blob : blob_stats(connectivityFilter))
+            {
+                areas.push_back(blob.area);
+                volumes.push_back(blob.volume);
+            }
+        }
+        blobs_step = mesh_step;
+        have_blobs = true;
+        have_mesh = false;
+    }
+
+    // one output step with the blobs found last
+    void put_blobs()
+    {
+        if (!have_blobs)
+        {
+            return;
+        }
+        have_blobs = false;
+
+        if (first_step)
+        {
+            if (!rank)
+            {
+                var_nblobs = io.DefineVariable<int>("nblobs");
+                var_area = io.DefineVariable<double>("area", {0}, {0}, {0});
+                var_volume =
+                    io.DefineVariable<double>("volume", {0}, {0}, {0});
+                var_step = io.DefineVariable<int>("step");
+            }
+            first_step = false;
+        }
+
+        engine.BeginStep();
+        if (!rank)
+        {
+            std::cout << "blobs at step " << blobs_step << ": "
+                      << areas.size() << " blobs, largest area "
+                      << (areas.empty()
+                              ? 0.0
+                              : *std::max_element(areas.begin(), areas.end()))
+                      << std::endl;
+            engine.Put<int>(var_nblobs, static_cast<int>(areas.size()));
+            var_area.SetShape({areas.size()});
+            var_area.SetSelection({{0}, {areas.size()}});
+            var_volume.SetShape({volumes.size()});
+            var_volume.SetSelection({{0}, {volumes.size()}});
+            if (!areas.empty())
+            {
+                engine.Put<double>(var_area, areas.data());
+                engine.Put<double>(var_volume, volumes.data());
+            }
+            engine.Put<int>(var_step, blobs_step);
+        }
+        engine.EndStep();
+    }
+};
+#endif
+
+/*
+ * The stages of the config in their order. The output IO of a stage is
+ * named after its type, or "io" of the stage.
+ */
+std::vector<std::unique_ptr<Stage>> make_stages(const nlohmann::json &conf,
+                                                adios2::ADIOS &ad,
+                                                MPI_Comm comm)
+{
+    std::vector<std::unique_ptr<Stage>> stages;
+    std::set<std::string> ios;
+    for (const auto &s : conf.at("stages"))
+    {
+        const std::string type = s.at("type").get<std::string>();
+        std::string io_name;
+        if (type == "pdf")
+            io_name = "PDFAnalysisOutput";
+        else if (type == "norm")
+            io_name = "NormOutput";
+        else if (type == "reduce")
+            io_name = "ReduceOutput";
+        else if (type == "isosurface")
+            io_name = "IsosurfaceOutput";
+        else if (type == "blobs")
+            io_name = "BlobsOutput";
+        else
+            throw std::invalid_argument("ERROR: unknown stage type " + type +
+                                        "\n");
+        io_name = s.value("io", io_name);
+        if (!ios.insert(io_name).second)
+        {
+            throw std::invalid_argument("ERROR: stages need different \"io\", " +
+                                        io_name + " is used twice\n");
+        }
+        adios2::IO io = ad.DeclareIO(io_name);
+
+        if (type == "pdf")
+        {
+            stages.emplace_back(new PdfStage(s, io, comm));
+        }
+        else if (type == "norm")
+        {
+            stages.emplace_back(new NormStage(s, io, comm));
+        }
+        else if (type == "reduce")
+        {
+            stages.emplace_back(new ReduceStage(s, io, comm));
+        }
+        else if (type == "isosurface")
+        {
+            stages.emplace_back(new IsosurfaceStage(s, io, comm));
+        }
+#ifdef USE_VTK
+        else if (type == "blobs")
+        {
+            // the mesh of the named or the last isosurface stage before
+            const IsosurfaceStage *iso = nullptr;
+            for (const auto &stage : stages)
+            {
+                auto *p = dynamic_cast<const IsosurfaceStage *>(stage.get());
+                if (p && (!s.count("input") || p->name == s.at("input")))
+                {
+                    iso = p;
+                }
+            }
+            if (!iso)
+            {
+                throw std::invalid_argument(
+                    "ERROR: blobs needs an isosurface stage before it\n");
+            }
+            stages.emplace_back(new BlobsStage(s, io, comm, iso));
+        }
+#endif
+        else
+        {
+            throw std::invalid_argument("ERROR: stage " + type +
+                                        " needs analysis_host built with "
+                                        "VTK\n");
+        }
+    }
+    return stages;
+}
+
+void printUsage()
+{
+    std::cout
+        << "Usage: analysis_host config.json\n"
+        << "  config.json: input, optional adios_config, prefetch and wait "
+           "(as --wait=),\n"
+        << "               and stages, a list of objects with type (pdf, "
+           "norm, reduce,\n"
+        << "               isosurface, blobs), output, and optional name, io, "
+           "threads\n"
+        << "               and the settings of the type (pdf: bins, "
+           "isosurface:\n"
+        << "               isovalues, blobs: input)\n\n";
+}
+
+double seconds_since(std::chrono::steady_clock::time_point t0)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0)
+        .count();
+}
+
+/*
+ * The thread of a stage, kept for all steps. start() hands it a step to
+ * compute, finish() waits for compute() and returns its exception, if any.
+ */
+class StageWorker
+{
+public:
+    explicit StageWorker(Stage &stage)
+    : stage(stage), thread(&StageWorker::run, this)
+    {
+    }
+
+    ~StageWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        cv.notify_all();
+        thread.join();
+    }
+
+    StageWorker(const StageWorker &) = delete;
+    StageWorker &operator=(const StageWorker &) = delete;
+
+    void start(const HostStep &in)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            step = &in;
+            busy = true;
+        }
+        cv.notify_all();
+    }
+
+    std::exception_ptr finish()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return !busy; });
+        std::exception_ptr e = error;
+        error = nullptr;
+        return e;
+    }
+
+private:
+    Stage &stage;
+    std::mutex mutex;
+    std::condition_variable cv;
+    const HostStep *step = nullptr;
+    bool busy = false;
+    bool quit = false;
+    std::exception_ptr error;
+    std::thread thread; // last, starts after the other members
+
+    void run()
+    {
+        while (true)
+        {
+            const HostStep *in;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return quit || step; });
+                if (!step)
+                {
+                    return;
+                }
+                in = step;
+                step = nullptr;
+            }
+
+            std::exception_ptr e;
+            const auto t0 = std::chrono::steady_clock::now();
+            try
+            {
+                stage.compute(*in);
+            }
+            catch (...)
+            {
+                e = std::current_exception();
+            }
+            stage.compute_time += seconds_since(t0);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = e;
+                busy = false;
+            }
+            cv.notify_all();
+        }
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    // steps are read ahead in a background thread
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+
+    int rank, nproc, wrank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &wrank);
+
+    const unsigned int color = 7;
+    MPI_Comm comm;
+    MPI_Comm_split(MPI_COMM_WORLD, color, wrank, &comm);
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nproc);
+
+    try
+    {
+        if (argc < 2)
+        {
+            throw std::invalid_argument("ERROR: no config file\n");
+        }
+        std::ifstream ifs(argv[1]);
+        if (!ifs)
+        {
+            throw std::invalid_argument("ERROR: cannot open " +
+                                        std::string(argv[1]) + "\n");
+        }
+        nlohmann::json conf;
+        ifs >> conf;
+
+        const std::string input = conf.at("input").get<std::string>();
+        const int prefetch = std::max(0, conf.value("prefetch", 1));
+        WaitPolicy wait_policy;
+        if (conf.count("wait"))
+        {
+            parse_wait_option("--wait=" + conf.at("wait").get<std::string>(),
+                              wait_policy);
+        }
+
+        adios2::ADIOS ad(conf.value("adios_config", std::string("adios2.xml")),
+                         comm);
+        std::vector<std::unique_ptr<Stage>> stages =
+            make_stages(conf, ad, comm);
+
+        bool read_v = false, next_slice = false, need_minmax = false;
+        for (const auto &stage : stages)
+        {
+            read_v = read_v || stage->needs_v();
+            next_slice = next_slice || stage->needs_next_slice();
+            need_minmax = need_minmax || stage->needs_minmax();
+        }
+
+        adios2::IO reader_io = ad.DeclareIO("SimulationOutput");
+        const std::string engine_type = reader_io.EngineType();
+        if (!rank)
+        {
+            std::cout << "Analysis host reads " << input << " with engine "
+                      << engine_type << ", stages:";
+            for (const auto &stage : stages)
+            {
+                std::cout << " " << stage->name;
+            }
+            std::cout << std::endl;
+        }
+
+        // Slab of this process, with the first slice of the next process for
+        // the isosurfaces; the selection is the same for all steps
+        auto read_input = [&](adios2::IO &io, adios2::Engine &reader,
+                              HostStep &in) {
+            adios2::Variable<double> var_u = io.InquireVariable<double>("U");
+            adios2::Variable<double> var_v = io.InquireVariable<double>("V");
+            adios2::Variable<int> var_step = io.InquireVariable<int>("step");
+
+            in.shape = var_u.Shape();
+            size_t start, count;
+            partition(in.shape[0], nproc, rank, start, count);
+            in.nslices = count;
+            if (next_slice && count && start + count < in.shape[0])
+            {
+                ++count;
+            }
+            in.start = {start, 0, 0};
+            in.count = {count, in.shape[1], in.shape[2]};
+
+            in.have_minmax = false;
+            if (need_minmax && engine_type != "HDF5")
+            {
+                try
+                {
+                    in.minmax_u = var_u.MinMax();
+                    in.minmax_v = var_v.MinMax();
+                    in.have_minmax = in.minmax_u.first < in.minmax_u.second &&
+                                     in.minmax_v.first < in.minmax_v.second;
+                }
+                catch (std::exception &e)
+                {
+                    // no statistics in the metadata
+                }
+            }
+
+            if (count)
+            {
+                var_u.SetSelection({in.start, in.count});
+                reader.Get<double>(var_u, in.u);
+                if (read_v)
+                {
+                    var_v.SetSelection({in.start, in.count});
+                    reader.Get<double>(var_v, in.v);
+                }
+            }
+            else
+            {
+                in.u.clear();
+                in.v.clear();
+            }
+            reader.Get<int>(var_step, &in.sim_step);
+        };
+
+        StepReader<HostStep> reader(reader_io, input, comm, read_input,
+                                    prefetch, true, wait_policy);
+
+        std::vector<std::unique_ptr<StageWorker>> workers;
+        for (auto &stage : stages)
+        {
+            workers.emplace_back(new StageWorker(*stage));
+        }
+
+        int step = 0;
+        while (true)
+        {
+            HostStep *in = reader.next();
+            if (!in)
+            {
+                break;
+            }
+
+            if (!rank)
+            {
+                std::cout << "Analysis host step " << step
+                          << " processing sim step " << in->sim_step
+                          << ", waited " << reader.current_wait() << " s"
+                          << std::endl;
+            }
+
+            // global min/max from the data if the metadata has none
+            if (need_minmax && !in->have_minmax)
+            {
+                double mm[4];
+                minmax_fused(in->u, in->v, mm);
+                double local[4] = {mm[0], mm[1], -mm[2], -mm[3]};
+                MPI_Allreduce(local, mm, 4, MPI_DOUBLE, MPI_MIN, comm);
+                in->minmax_u = std::make_pair(mm[0], -mm[2]);
+                in->minmax_v = std::make_pair(mm[1], -mm[3]);
+                in->have_minmax = true;
+            }
+
+            // all stages compute the step at the same time
+            for (auto &worker : workers)
+            {
+                worker->start(*in);
+            }
+            std::exception_ptr error;
+            for (auto &worker : workers)
+            {
+                std::exception_ptr e = worker->finish();
+                if (e && !error)
+                {
+                    error = e;
+                }
+            }
+
+            // the writes are collective, so all processes stop if a stage
+            // failed on any of them
+            int failed = error ? 1 : 0;
+            MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_LOR, comm);
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            if (failed)
+            {
+                throw std::runtime_error(
+                    "ERROR: a stage failed on another process\n");
+            }
+
+            for (auto &stage : stages)
+            {
+                const auto t0 = std::chrono::steady_clock::now();
+                stage->write(*in);
+                stage->write_time += seconds_since(t0);
+            }
+            ++step;
+        }
+
+        reader.close();
+        for (auto &stage : stages)
+        {
+            stage->close();
+        }
+        if (!rank)
+        {
+            reader.wait_stats().print_summary(std::cout, "Analysis host");
+            for (const auto &stage : stages)
+            {
+                std::cout << "  " << stage->name << ": compute "
+                          << stage->compute_time << " s, write "
+                          << stage->write_time << " s" << std::endl;
+            }
+        }
+    }
+    catch (std::invalid_argument &e) // config errors
+    {
+        if (!rank)
+        {
+            std::cout << e.what() << std::endl;
+            printUsage();
+        }
+    }
+    catch (nlohmann::json::exception &e)
+    {
+        if (!rank)
+        {
+            std::cout << "ERROR: config: " << e.what() << std::endl;
+            printUsage();
+        }
+    }
+    catch (std::exception &e) // a stage failed
+    {
+        std::cerr << e.what() << std::endl;
+        MPI_Abort(MPI_COMM_WORLD, -1);
+    }
+
+    MPI_Finalize();
+    return 0;
+}
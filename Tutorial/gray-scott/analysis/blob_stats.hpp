@@ -0,0 +1,111 @@
+#ifndef __BLOB_STATS_HPP__
+#define __BLOB_STATS_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <vtkCellData.h>
+#include <vtkConnectivityFilter.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkIdList.h>
+#include <vtkSmartPointer.h>
+
+/*
+ * Statistics of a blob, a connected region of a triangle mesh
+ */
+struct BlobStats
+{
+    vtkIdType ncells = 0;
+    double area = 0.0;
+    double volume = 0.0;                 // enclosed, for closed blobs
+    double centroid[3] = {0.0, 0.0, 0.0}; // of the surface
+    double bounds[6] = {std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest(),
+                        std::numeric_limits<double>::max(),
+                        std::numeric_limits<double>::lowest()};
+};
+
+/*
+ * The statistics of all regions of the output of a vtkConnectivityFilter
+ * that extracted all regions with ColorRegionsOn, in one pass over its
+ * triangles by their RegionId. The volume is the sum of the signed volumes
+ * of the tetrahedra of the triangles and the origin (divergence theorem),
+ * so it is the enclosed volume of a closed, consistently oriented blob; the
+ * centroid is that of the surface, weighted by area.
+ */
+inline std::vector<BlobStats> blob_stats(vtkConnectivityFilter *filter)
+{
+    vtkDataSet *mesh = filter->GetOutput();
+    std::vector<BlobStats> stats(filter->GetNumberOfExtractedRegions());
+    vtkDataArray *regions = mesh->GetCellData()->GetArray("RegionId");
+    if (!regions)
+    {
+        return stats;
+    }
+
+    auto ids = vtkSmartPointer<vtkIdList>::New();
+    double p[3][3];
+    const vtkIdType nCells = mesh->GetNumberOfCells();
+    for (vtkIdType c = 0; c < nCells; c++)
+    {
+        mesh->GetCellPoints(c, ids);
+        const vtkIdType r =
+            static_cast<vtkIdType>(regions->GetComponent(c, 0));
+        if (ids->GetNumberOfIds() != 3 || r < 0 ||
+            r >= static_cast<vtkIdType>(stats.size()))
+        {
+            continue;
+        }
+        for (int k = 0; k < 3; k++)
+        {
+            mesh->GetPoint(ids->GetId(k), p[k]);
+        }
+
+        BlobStats &s = stats[r];
+        double u[3], w[3], n[3];
+        for (int d = 0; d < 3; d++)
+        {
+            u[d] = p[1][d] - p[0][d];
+            w[d] = p[2][d] - p[0][d];
+        }
+        n[0] = u[1] * w[2] - u[2] * w[1];
+        n[1] = u[2] * w[0] - u[0] * w[2];
+        n[2] = u[0] * w[1] - u[1] * w[0];
+        const double area =
+            0.5 * std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+        // p0 . (p1 x p2) / 6
+        s.volume += (p[0][0] * (p[1][1] * p[2][2] - p[1][2] * p[2][1]) +
+                     p[0][1] * (p[1][2] * p[2][0] - p[1][0] * p[2][2]) +
+                     p[0][2] * (p[1][0] * p[2][1] - p[1][1] * p[2][0])) /
+                    6.0;
+        s.area += area;
+        for (int d = 0; d < 3; d++)
+        {
+            s.centroid[d] += area * (p[0][d] + p[1][d] + p[2][d]) / 3.0;
+            for (int k = 0; k < 3; k++)
+            {
+                s.bounds[2 * d] = std::min(s.bounds[2 * d], p[k][d]);
+                s.bounds[2 * d + 1] = std::max(s.bounds[2 * d + 1], p[k][d]);
+            }
+        }
+        s.ncells++;
+    }
+
+    for (auto &s : stats)
+    {
+        for (int d = 0; d < 3; d++)
+        {
+            s.centroid[d] = s.area > 0.0 ? s.centroid[d] / s.area : 0.0;
+        }
+        s.volume = std::abs(s.volume);
+    }
+    return stats;
+}
+
+#endif
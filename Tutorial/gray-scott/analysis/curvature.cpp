@@ -11,58 +11,13 @@
 
 #include <adios2.h>
 
-#include <vtkCellArray.h>
 #include <vtkCurvatures.h>
-#include <vtkDoubleArray.h>
-#include <vtkPointData.h>
-#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkSmartPointer.h>
-#include <vtkUnstructuredGrid.h>
 
+#include "../common/mesh_encoding.hpp"
 #include "../common/timer.hpp"
-
-vtkSmartPointer<vtkPolyData> read_mesh(const std::vector<double> &bufPoints,
-                                       const std::vector<int> &bufCells,
-                                       const std::vector<double> &bufNormals)
-{
-    int nPoints = bufPoints.size() / 3;
-    int nCells = bufCells.size() / 3;
-
-    auto points = vtkSmartPointer<vtkPoints>::New();
-    points->SetNumberOfPoints(nPoints);
-    for (vtkIdType i = 0; i < nPoints; i++)
-    {
-        points->SetPoint(i, &bufPoints[i * 3]);
-    }
-
-    auto polys = vtkSmartPointer<vtkCellArray>::New();
-    for (vtkIdType i = 0; i < nCells; i++)
-    {
-        vtkIdType a = bufCells[i * 3 + 0];
-        vtkIdType b = bufCells[i * 3 + 1];
-        vtkIdType c = bufCells[i * 3 + 2];
-
-        polys->InsertNextCell(3);
-        polys->InsertCellPoint(a);
-        polys->InsertCellPoint(b);
-        polys->InsertCellPoint(c);
-    }
-
-    auto normals = vtkSmartPointer<vtkDoubleArray>::New();
-    normals->SetNumberOfComponents(3);
-    for (vtkIdType i = 0; i < nPoints; i++)
-    {
-        normals->InsertNextTuple(&bufNormals[i * 3]);
-    }
-
-    auto polyData = vtkSmartPointer<vtkPolyData>::New();
-    polyData->SetPoints(points);
-    polyData->SetPolys(polys);
-    polyData->GetPointData()->SetNormals(normals);
-
-    return polyData;
-}
+#include "../common/vtk_mesh.hpp"
 
 void compute_curvature(const vtkSmartPointer<vtkPolyData> polyData)
 {
@@ -112,9 +67,8 @@ int main(int argc, char *argv[])
     adios2::IO outIO = adios.DeclareIO("CurvatureOutput");
     adios2::Engine writer = outIO.Open(output_fname, adios2::Mode::Write);
 
-    std::vector<double> points;
-    std::vector<int> cells;
-    std::vector<double> normals;
+    VtkMesh vtkMesh;
+    MeshInput mesh;
     int step;
 
 #ifdef ENABLE_TIMERS
@@ -144,28 +98,14 @@ int main(int argc, char *argv[])
             break;
         }
 
-        auto varPoint = inIO.InquireVariable<double>("point");
-        auto varCell = inIO.InquireVariable<int>("cell");
-        auto varNormal = inIO.InquireVariable<double>("normal");
         auto varStep = inIO.InquireVariable<int>("step");
 
-        if (varPoint.Shape().size() > 0 || varCell.Shape().size() > 0)
-        {
-            varPoint.SetSelection(
-                {{0, 0}, {varPoint.Shape()[0], varPoint.Shape()[1]}});
-            varCell.SetSelection(
-                {{0, 0}, {varCell.Shape()[0], varCell.Shape()[1]}});
-            varNormal.SetSelection(
-                {{0, 0}, {varNormal.Shape()[0], varNormal.Shape()[1]}});
-
-            reader.Get<double>(varPoint, points);
-            reader.Get<int>(varCell, cells);
-            reader.Get<double>(varNormal, normals);
-        }
-
+        mesh.get(inIO, reader, vtkMesh.points, vtkMesh.cells,
+                 vtkMesh.normals);
         reader.Get<int>(varStep, &step);
 
         reader.EndStep();
+        mesh.decode(vtkMesh.points, vtkMesh.cells, vtkMesh.normals);
 
 #ifdef ENABLE_TIMERS
         double time_read = timer_read.stop();
@@ -173,9 +113,7 @@ int main(int argc, char *argv[])
         timer_compute.start();
 #endif
 
-        vtkSmartPointer<vtkPolyData> polyData =
-            read_mesh(points, cells, normals);
-        compute_curvature(polyData);
+        compute_curvature(vtkMesh.poly_data());
 
         if (!rank)
         {
@@ -12,61 +12,14 @@
 
 #include <adios2.h>
 
-#include <vtkCellArray.h>
 #include <vtkConnectivityFilter.h>
-#include <vtkDataSetSurfaceFilter.h>
-#include <vtkDoubleArray.h>
-#include <vtkMassProperties.h>
-#include <vtkPointData.h>
-#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkSmartPointer.h>
-#include <vtkThreshold.h>
-#include <vtkUnstructuredGrid.h>
 
+#include "../common/mesh_encoding.hpp"
 #include "../common/timer.hpp"
-
-vtkSmartPointer<vtkPolyData> read_mesh(const std::vector<double> &bufPoints,
-                                       const std::vector<int> &bufCells,
-                                       const std::vector<double> &bufNormals)
-{
-    int nPoints = bufPoints.size() / 3;
-    int nCells = bufCells.size() / 3;
-
-    auto points = vtkSmartPointer<vtkPoints>::New();
-    points->SetNumberOfPoints(nPoints);
-    for (vtkIdType i = 0; i < nPoints; i++)
-    {
-        points->SetPoint(i, &bufPoints[i * 3]);
-    }
-
-    auto polys = vtkSmartPointer<vtkCellArray>::New();
-    for (vtkIdType i = 0; i < nCells; i++)
-    {
-        vtkIdType a = bufCells[i * 3 + 0];
-        vtkIdType b = bufCells[i * 3 + 1];
-        vtkIdType c = bufCells[i * 3 + 2];
-
-        polys->InsertNextCell(3);
-        polys->InsertCellPoint(a);
-        polys->InsertCellPoint(b);
-        polys->InsertCellPoint(c);
-    }
-
-    auto normals = vtkSmartPointer<vtkDoubleArray>::New();
-    normals->SetNumberOfComponents(3);
-    for (vtkIdType i = 0; i < nPoints; i++)
-    {
-        normals->InsertNextTuple(&bufNormals[i * 3]);
-    }
-
-    auto polyData = vtkSmartPointer<vtkPolyData>::New();
-    polyData->SetPoints(points);
-    polyData->SetPolys(polys);
-    polyData->GetPointData()->SetNormals(normals);
-
-    return polyData;
-}
+#include "../common/vtk_mesh.hpp"
+#include "blob_stats.hpp"
 
 void find_blobs(const vtkSmartPointer<vtkPolyData> polyData)
 {
@@ -76,42 +29,28 @@ void find_blobs(const vtkSmartPointer<vtkPolyData> polyData)
     connectivityFilter->ColorRegionsOn();
     connectivityFilter->Update();
 
-    int nBlobs = connectivityFilter->GetNumberOfExtractedRegions();
+    const std::vector<BlobStats> blobs = blob_stats(connectivityFilter);
 
-    std::cout << "Found " << nBlobs << " blobs" << std::endl;
+    std::cout << "Found " << blobs.size() << " blobs" << std::endl;
 
-    auto threshold = vtkSmartPointer<vtkThreshold>::New();
-    auto massProperties = vtkSmartPointer<vtkMassProperties>::New();
-    auto surfaceFilter = vtkSmartPointer<vtkDataSetSurfaceFilter>::New();
-
-    threshold->SetInputConnection(connectivityFilter->GetOutputPort());
-    surfaceFilter->SetInputConnection(threshold->GetOutputPort());
-    massProperties->SetInputConnection(surfaceFilter->GetOutputPort());
-
-    for (int i = 0; i < nBlobs; i++)
+    size_t largest = 0;
+    for (size_t i = 0; i < blobs.size(); i++)
     {
-        threshold->ThresholdBetween(i, i);
-
-        std::cout << "Surface area of blob #" << i << " is "
-                  << massProperties->GetSurfaceArea() << std::endl;
+        const BlobStats &b = blobs[i];
+        std::cout << "Blob #" << i << ": area " << b.area << ", volume "
+                  << b.volume << ", centroid (" << b.centroid[0] << ", "
+                  << b.centroid[1] << ", " << b.centroid[2] << ")"
+                  << std::endl;
+        if (b.area > blobs[largest].area)
+        {
+            largest = i;
+        }
+    }
+    if (!blobs.empty())
+    {
+        std::cout << "Surface area of largest blob is "
+                  << blobs[largest].area << std::endl;
     }
-}
-
-void find_largest_blob(const vtkSmartPointer<vtkPolyData> polyData)
-{
-    auto connectivityFilter = vtkSmartPointer<vtkConnectivityFilter>::New();
-    connectivityFilter->SetInputData(polyData);
-    connectivityFilter->SetExtractionModeToLargestRegion();
-    connectivityFilter->Update();
-
-    auto massProperties = vtkSmartPointer<vtkMassProperties>::New();
-    auto surfaceFilter = vtkSmartPointer<vtkDataSetSurfaceFilter>::New();
-
-    surfaceFilter->SetInputConnection(connectivityFilter->GetOutputPort());
-    massProperties->SetInputConnection(surfaceFilter->GetOutputPort());
-
-    std::cout << "Surface area of largest blob is "
-              << massProperties->GetSurfaceArea() << std::endl;
 }
 
 int main(int argc, char *argv[])
@@ -134,7 +73,7 @@ int main(int argc, char *argv[])
         if (rank == 0)
         {
             std::cerr << "Too few arguments" << std::endl;
-            std::cout << "Usage: find_blobs input" << std::endl;
+            std::cout << "Usage: find_blobs input [--lod=K]" << std::endl;
         }
         MPI_Abort(MPI_COMM_WORLD, -1);
     }
@@ -143,7 +82,8 @@ int main(int argc, char *argv[])
     {
         if (rank == 0)
         {
-            std::cerr << "find_blobs only supports serial execution"
+            std::cerr << "find_blobs only supports serial execution, "
+                         "volume_blobs finds blobs in parallel"
                       << std::endl;
         }
         MPI_Abort(MPI_COMM_WORLD, -1);
@@ -151,14 +91,20 @@ int main(int argc, char *argv[])
 
     const std::string input_fname(argv[1]);
 
+    // --lod=K reads level K of the mesh
+    std::string lod;
+    for (int i = 2; i < argc; i++)
+    {
+        parse_lod_option(argv[i], lod);
+    }
+
     adios2::ADIOS adios("adios2.xml", comm);
 
     adios2::IO inIO = adios.DeclareIO("IsosurfaceOutput");
     adios2::Engine reader = inIO.Open(input_fname, adios2::Mode::Read);
 
-    std::vector<double> points;
-    std::vector<int> cells;
-    std::vector<double> normals;
+    VtkMesh vtkMesh;
+    MeshInput mesh(lod);
     int step;
 
 #ifdef ENABLE_TIMERS
@@ -188,28 +134,14 @@ int main(int argc, char *argv[])
             break;
         }
 
-        auto varPoint = inIO.InquireVariable<double>("point");
-        auto varCell = inIO.InquireVariable<int>("cell");
-        auto varNormal = inIO.InquireVariable<double>("normal");
         auto varStep = inIO.InquireVariable<int>("step");
 
-        if (varPoint.Shape().size() > 0 || varCell.Shape().size() > 0)
-        {
-            varPoint.SetSelection(
-                {{0, 0}, {varPoint.Shape()[0], varPoint.Shape()[1]}});
-            varCell.SetSelection(
-                {{0, 0}, {varCell.Shape()[0], varCell.Shape()[1]}});
-            varNormal.SetSelection(
-                {{0, 0}, {varNormal.Shape()[0], varNormal.Shape()[1]}});
-
-            reader.Get<double>(varPoint, points);
-            reader.Get<int>(varCell, cells);
-            reader.Get<double>(varNormal, normals);
-        }
-
+        mesh.get(inIO, reader, vtkMesh.points, vtkMesh.cells,
+                 vtkMesh.normals);
         reader.Get<int>(varStep, &step);
 
         reader.EndStep();
+        mesh.decode(vtkMesh.points, vtkMesh.cells, vtkMesh.normals);
 
 #ifdef ENABLE_TIMERS
         double time_read = timer_read.stop();
@@ -219,9 +151,7 @@ int main(int argc, char *argv[])
 
         std::cout << "find_blobs at step " << step << std::endl;
 
-        auto polyData = read_mesh(points, cells, normals);
-        // find_blobs(polyData);
-        find_largest_blob(polyData);
+        find_blobs(vtkMesh.poly_data());
 
 #ifdef ENABLE_TIMERS
         double time_compute = timer_compute.stop();
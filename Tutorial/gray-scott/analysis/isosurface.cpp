@@ -1,178 +1,434 @@
 /*
  * Analysis code for the Gray-Scott simulation.
- * Reads variable U and and extracts the iso-surface using VTK.
+ * Reads variable U and and extracts the iso-surface with marching cubes.
  * Writes the extracted iso-surface using ADIOS.
  *
  * Keichi Takahashi <keichi@is.naist.jp>
  *
  */
 
+#include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <adios2.h>
 
-#include <vtkAppendPolyData.h>
-#include <vtkImageData.h>
-#include <vtkImageImport.h>
-#include <vtkMarchingCubes.h>
-#include <vtkPointData.h>
-#include <vtkPolyData.h>
-#include <vtkSmartPointer.h>
-#include <vtkXMLPolyDataWriter.h>
-
+#include "../common/step_reader.hpp"
 #include "../common/timer.hpp"
+#include "isosurface.hpp"
 
-vtkSmartPointer<vtkPolyData>
-compute_isosurface(const adios2::Variable<double> &varField,
-                   const std::vector<double> &field, double isovalue)
+/*
+ * Part of U with one layer of overlap to the next parts, so that it has all
+ * cells whose lower corner is in the part
+ */
+struct Piece
 {
-    // Convert field values to vtkImageData
-    auto importer = vtkSmartPointer<vtkImageImport>::New();
-    importer->SetDataSpacing(1, 1, 1);
-    importer->SetDataOrigin(varField.Start()[2], varField.Start()[1],
-                            varField.Start()[0]);
-    importer->SetWholeExtent(0, varField.Count()[2] - 1, 0,
-                             varField.Count()[1] - 1, 0,
-                             varField.Count()[0] - 1);
-    importer->SetDataExtentToWholeExtent();
-    importer->SetDataScalarTypeToDouble();
-    importer->SetNumberOfScalarComponents(1);
-    importer->SetImportVoidPointer(const_cast<double *>(field.data()));
-
-    // Run the marching cubes algorithm
-    auto mcubes = vtkSmartPointer<vtkMarchingCubes>::New();
-    mcubes->SetInputConnection(importer->GetOutputPort());
-    mcubes->ComputeNormalsOn();
-    mcubes->SetValue(0, isovalue);
-    mcubes->Update();
-
-    // Return the isosurface as vtkPolyData
-    return mcubes->GetOutput();
-}
+    adios2::Dims start;
+    adios2::Dims count;
+    adios2::Dims own; // count without the overlap
+    std::vector<double> u;
+    std::vector<double> block; // as read, with --decomp=writer
+};
 
-void write_vtk(const std::string &fname,
-               const vtkSmartPointer<vtkPolyData> polyData)
+/*
+ * Region of the overlap of a piece of this process, from the block of
+ * another piece, or read from the file if no process reads that block
+ */
+struct Halo
 {
-    auto writer = vtkSmartPointer<vtkXMLPolyDataWriter>::New();
-    writer->SetFileName(fname.c_str());
-    writer->SetInputData(polyData);
-    writer->Write();
-}
-
-void write_adios(adios2::Engine &writer,
-                 const vtkSmartPointer<vtkPolyData> polyData,
-                 adios2::Variable<double> &varPoint,
-                 adios2::Variable<int> &varCell,
-                 adios2::Variable<double> &varNormal,
-                 adios2::Variable<int> &varOutStep, int step, MPI_Comm comm)
+    size_t piece;
+    Box region;
+    int rank;              // with the block, -1 if read by this process
+    size_t from;           // piece with the block, if rank is this process
+    std::vector<double> u; // if read by this process
+};
+
+// Region of the block of a piece of this process that another one needs
+struct HaloSend
 {
-    int numCells = polyData->GetNumberOfPolys();
-    int numPoints = polyData->GetNumberOfPoints();
+    size_t piece;
+    Box region;
     int rank;
+};
 
-    MPI_Comm_rank(comm, &rank);
-
-    std::vector<double> points(numPoints * 3);
-    std::vector<double> normals(numPoints * 3);
-    std::vector<int> cells(numCells * 3); // Assumes that cells are triangles
-
-    double coords[3];
-
-    auto cellArray = polyData->GetPolys();
-
-    cellArray->InitTraversal();
+/*
+ * Parts of U of one step, read ahead of the computation by the StepReader
+ */
+struct InputStep
+{
+    std::vector<Piece> pieces;
+    std::vector<Halo> halos;     // with --decomp=writer
+    std::vector<HaloSend> sends; // the same
+    adios2::Dims shape;
+    size_t active_blocks = 0; // writer blocks read by all processes
+    size_t blocks = 0;        // 0 if reading a box of the whole array
+    int step = 0;
+};
 
-    // Iterate through cells
-    for (int i = 0; i < polyData->GetNumberOfPolys(); i++)
+/*
+ * Writer blocks whose values and those of the next blocks up to one layer
+ * away bracket an isovalue, so they have cells crossing it, and their
+ * indices into ids if given. Returns false if the blocks have no min/max
+ * (e.g. HDF5, or statistics turned off).
+ */
+bool active_blocks(const std::vector<adios2::Variable<double>::Info> &blocks,
+                   const std::vector<double> &isovalues,
+                   std::vector<Box> &active,
+                   std::vector<size_t> *ids = nullptr)
+{
+    bool stats = false;
+    for (const auto &b : blocks)
     {
-        auto idList = vtkSmartPointer<vtkIdList>::New();
-
-        cellArray->GetNextCell(idList);
+        stats = stats || b.Min < b.Max;
+    }
+    if (!stats)
+    {
+        return false;
+    }
 
-        // Iterate through points of a cell
-        for (int j = 0; j < idList->GetNumberOfIds(); j++)
+    active.clear();
+    if (ids)
+    {
+        ids->clear();
+    }
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        const auto &b = blocks[i];
+        double lo = b.Min, hi = b.Max;
+        for (const auto &n : blocks)
         {
-            auto id = idList->GetId(j);
-
-            cells[i * 3 + j] = id;
-
-            polyData->GetPoint(id, coords);
-
-            points[id * 3 + 0] = coords[0];
-            points[id * 3 + 1] = coords[1];
-            points[id * 3 + 2] = coords[2];
+            bool touches = true;
+            for (int d = 0; d < 3; ++d)
+            {
+                touches = touches && n.Start[d] <= b.Start[d] + b.Count[d] &&
+                          b.Start[d] < n.Start[d] + n.Count[d];
+            }
+            if (touches)
+            {
+                lo = std::min(lo, n.Min);
+                hi = std::max(hi, n.Max);
+            }
+        }
+        for (const double iso : isovalues)
+        {
+            if (lo < iso && iso <= hi)
+            {
+                active.push_back({b.Start, b.Count});
+                if (ids)
+                {
+                    ids->push_back(i);
+                }
+                break;
+            }
         }
     }
+    return true;
+}
 
-    auto normalArray = polyData->GetPointData()->GetNormals();
-
-    // Extract normals
-    for (int i = 0; i < normalArray->GetNumberOfTuples(); i++)
+/*
+ * Process of each box, largest first to the least loaded process
+ */
+std::vector<int> assign_owners(const std::vector<Box> &boxes, int nproc)
+{
+    auto volume = [](const Box &b) {
+        return b.second[0] * b.second[1] * b.second[2];
+    };
+    std::vector<size_t> order(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i)
     {
-        normalArray->GetTuple(i, coords);
-
-        normals[i * 3 + 0] = coords[0];
-        normals[i * 3 + 1] = coords[1];
-        normals[i * 3 + 2] = coords[2];
+        order[i] = i;
     }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return volume(boxes[a]) > volume(boxes[b]);
+    });
 
-    int totalPoints, offsetPoints;
-    MPI_Allreduce(&numPoints, &totalPoints, 1, MPI_INT, MPI_SUM, comm);
-    MPI_Scan(&numPoints, &offsetPoints, 1, MPI_INT, MPI_SUM, comm);
+    std::vector<size_t> load(nproc, 0);
+    std::vector<int> owner(boxes.size());
+    for (size_t i : order)
+    {
+        int p = static_cast<int>(std::min_element(load.begin(), load.end()) -
+                                 load.begin());
+        load[p] += volume(boxes[i]);
+        owner[i] = p;
+    }
+    return owner;
+}
 
-    writer.BeginStep();
+/*
+ * Boxes of this process: the largest boxes are halved along their longest
+ * side until there is one for each process, then they are assigned with
+ * assign_owners()
+ */
+std::vector<Box> assign_boxes(std::vector<Box> boxes, int rank, int nproc)
+{
+    auto volume = [](const Box &b) {
+        return b.second[0] * b.second[1] * b.second[2];
+    };
+    while (boxes.size() < static_cast<size_t>(nproc) && !boxes.empty())
+    {
+        auto largest = std::max_element(
+            boxes.begin(), boxes.end(), [&](const Box &a, const Box &b) {
+                return volume(a) < volume(b);
+            });
+        const int d = static_cast<int>(
+            std::max_element(largest->second.begin(), largest->second.end()) -
+            largest->second.begin());
+        const size_t half = largest->second[d] / 2;
+        if (!half)
+        {
+            break;
+        }
+        Box upper = *largest;
+        upper.first[d] += half;
+        upper.second[d] -= half;
+        largest->second[d] = half;
+        boxes.push_back(upper);
+    }
 
-    varPoint.SetShape({static_cast<size_t>(totalPoints),
-                       static_cast<size_t>(totalPoints > 0 ? 3 : 0)});
-    varPoint.SetSelection({{static_cast<size_t>(offsetPoints - numPoints), 0},
-                           {static_cast<size_t>(numPoints),
-                            static_cast<size_t>(numPoints > 0 ? 3 : 0)}});
+    const std::vector<int> owner = assign_owners(boxes, nproc);
+    std::vector<Box> own;
+    for (size_t i = 0; i < boxes.size(); ++i)
+    {
+        if (owner[i] == rank)
+        {
+            own.push_back(boxes[i]);
+        }
+    }
+    return own;
+}
 
-    varNormal.SetShape(varPoint.Shape());
-    varNormal.SetSelection({varPoint.Start(), varPoint.Count()});
+// the common part of a and b into c, false if there is none
+bool intersect(const Box &a, const Box &b, Box &c)
+{
+    c = a;
+    for (int d = 0; d < 3; ++d)
+    {
+        const size_t lo = std::max(a.first[d], b.first[d]);
+        const size_t hi = std::min(a.first[d] + a.second[d],
+                                   b.first[d] + b.second[d]);
+        if (lo >= hi)
+        {
+            return false;
+        }
+        c.first[d] = lo;
+        c.second[d] = hi - lo;
+    }
+    return true;
+}
 
-    if (numPoints)
+// region of array src with box from into array dst with box to
+void copy_region(const double *src, const Box &from, double *dst,
+                 const Box &to, const Box &region)
+{
+    for (size_t i = 0; i < region.second[0]; ++i)
     {
-        writer.Put(varPoint, points.data());
-        writer.Put(varNormal, normals.data());
+        for (size_t j = 0; j < region.second[1]; ++j)
+        {
+            const size_t x = region.first[0] + i, y = region.first[1] + j;
+            const double *s =
+                src + ((x - from.first[0]) * from.second[1] +
+                       (y - from.first[1])) *
+                          from.second[2] +
+                (region.first[2] - from.first[2]);
+            double *t = dst +
+                        ((x - to.first[0]) * to.second[1] +
+                         (y - to.first[1])) *
+                            to.second[2] +
+                        (region.first[2] - to.first[2]);
+            std::copy_n(s, region.second[2], t);
+        }
     }
+}
 
-    int totalCells, offsetCells;
-    MPI_Allreduce(&numCells, &totalCells, 1, MPI_INT, MPI_SUM, comm);
-    MPI_Scan(&numCells, &offsetCells, 1, MPI_INT, MPI_SUM, comm);
+/*
+ * Pieces of whole writer blocks, read with block selections, with their
+ * overlap from the blocks of the processes that read them or read from the
+ * file if no process does. The owner of each block is known to all
+ * processes, and the sends and halos are listed in the same order on both
+ * sides.
+ */
+void read_writer_blocks(adios2::Engine &reader, adios2::Variable<double> &varU,
+                        const std::vector<adios2::Variable<double>::Info> &blocks,
+                        const std::vector<double> &isovalues, int rank,
+                        int nproc, InputStep &in)
+{
+    // without min/max all blocks are read
+    std::vector<Box> boxes, active;
+    for (const auto &b : blocks)
+    {
+        boxes.push_back({b.Start, b.Count});
+    }
+    std::vector<size_t> ids;
+    if (!active_blocks(blocks, isovalues, active, &ids))
+    {
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            ids.push_back(i);
+        }
+        active = boxes;
+    }
+    in.blocks = blocks.size();
+    in.active_blocks = ids.size();
+
+    const std::vector<int> owner = assign_owners(active, nproc);
+    // piece of this process and owner of each block, -1 if not read
+    std::vector<size_t> piece_of(blocks.size());
+    std::vector<int> owner_of(blocks.size(), -1);
+    size_t npieces = 0;
+    for (size_t a = 0; a < ids.size(); ++a)
+    {
+        owner_of[ids[a]] = owner[a];
+        if (owner[a] == rank)
+        {
+            piece_of[ids[a]] = npieces++;
+        }
+    }
+    in.pieces.resize(npieces);
+    for (size_t a = 0; a < ids.size(); ++a)
+    {
+        if (owner[a] != rank)
+        {
+            continue;
+        }
+        Piece &piece = in.pieces[piece_of[ids[a]]];
+        piece.start = active[a].first;
+        piece.own = active[a].second;
+        piece.count = piece.own;
+        for (int d = 0; d < 3; ++d)
+        {
+            piece.count[d] = std::min(piece.count[d] + 1,
+                                      in.shape[d] - piece.start[d]);
+        }
+        varU.SetBlockSelection(ids[a]);
+        reader.Get<double>(varU, piece.block);
+    }
 
-    for (int i = 0; i < cells.size(); i++)
+    in.halos.clear();
+    in.sends.clear();
+    for (size_t a = 0; a < ids.size(); ++a)
     {
-        cells[i] += (offsetPoints - numPoints);
+        Box extended = active[a];
+        for (int d = 0; d < 3; ++d)
+        {
+            extended.second[d] = std::min(extended.second[d] + 1,
+                                          in.shape[d] - extended.first[d]);
+        }
+        for (size_t b = 0; b < blocks.size(); ++b)
+        {
+            Box region;
+            if (b == ids[a] || !intersect(extended, boxes[b], region))
+            {
+                continue;
+            }
+            if (owner[a] == rank)
+            {
+                in.halos.push_back({piece_of[ids[a]], region, owner_of[b],
+                                    piece_of[b], {}});
+                if (owner_of[b] < 0)
+                {
+                    varU.SetSelection(region);
+                    reader.Get<double>(varU, in.halos.back().u);
+                }
+            }
+            else if (owner_of[b] == rank)
+            {
+                in.sends.push_back({piece_of[b], region, owner[a]});
+            }
+        }
     }
+}
 
-    varCell.SetShape({static_cast<size_t>(totalCells),
-                      static_cast<size_t>(totalCells > 0 ? 3 : 0)});
-    varCell.SetSelection({{static_cast<size_t>(offsetCells - numCells), 0},
-                          {static_cast<size_t>(numCells),
-                           static_cast<size_t>(numCells > 0 ? 3 : 0)}});
+/*
+ * The pieces of whole writer blocks with their overlap, after the blocks
+ * are read: the halos from other processes in one MPI_Alltoallv
+ */
+void exchange_halos(InputStep &in, MPI_Comm comm)
+{
+    if (!in.blocks)
+    {
+        // a box of the whole array was read
+        return;
+    }
+    int rank, nproc;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nproc);
 
-    if (numCells)
+    auto volume = [](const Box &b) {
+        return b.second[0] * b.second[1] * b.second[2];
+    };
+    for (auto &piece : in.pieces)
     {
-        writer.Put(varCell, cells.data());
+        piece.u.resize(piece.count[0] * piece.count[1] * piece.count[2]);
+        const Box own = {piece.start, piece.own};
+        copy_region(piece.block.data(), own, piece.u.data(),
+                    {piece.start, piece.count}, own);
     }
 
-    if (!rank)
+    std::vector<int> scounts(nproc, 0), rcounts(nproc, 0);
+    for (const auto &s : in.sends)
+    {
+        scounts[s.rank] += static_cast<int>(volume(s.region));
+    }
+    for (const auto &h : in.halos)
+    {
+        if (h.rank >= 0 && h.rank != rank)
+        {
+            rcounts[h.rank] += static_cast<int>(volume(h.region));
+        }
+    }
+    std::vector<int> sdispls(nproc, 0), rdispls(nproc, 0);
+    for (int r = 1; r < nproc; ++r)
     {
-        std::cout << "isosurface at step " << step << " writing out "
-                  << totalCells << " cells and " << totalPoints << " points"
-                  << std::endl;
+        sdispls[r] = sdispls[r - 1] + scounts[r - 1];
+        rdispls[r] = rdispls[r - 1] + rcounts[r - 1];
     }
 
-    writer.Put(varOutStep, step);
+    std::vector<double> sendbuf(sdispls[nproc - 1] + scounts[nproc - 1]);
+    std::vector<double> recvbuf(rdispls[nproc - 1] + rcounts[nproc - 1]);
+    std::vector<int> offset = sdispls;
+    for (const auto &s : in.sends)
+    {
+        const Piece &piece = in.pieces[s.piece];
+        copy_region(piece.block.data(), {piece.start, piece.own},
+                    sendbuf.data() + offset[s.rank], s.region, s.region);
+        offset[s.rank] += static_cast<int>(volume(s.region));
+    }
+    MPI_Alltoallv(sendbuf.data(), scounts.data(), sdispls.data(), MPI_DOUBLE,
+                  recvbuf.data(), rcounts.data(), rdispls.data(), MPI_DOUBLE,
+                  comm);
 
-    writer.EndStep();
+    offset = rdispls;
+    for (const auto &h : in.halos)
+    {
+        Piece &piece = in.pieces[h.piece];
+        const Box to = {piece.start, piece.count};
+        if (h.rank < 0)
+        {
+            copy_region(h.u.data(), h.region, piece.u.data(), to, h.region);
+        }
+        else if (h.rank == rank)
+        {
+            const Piece &from = in.pieces[h.from];
+            copy_region(from.block.data(), {from.start, from.own},
+                        piece.u.data(), to, h.region);
+        }
+        else
+        {
+            copy_region(recvbuf.data() + offset[h.rank], h.region,
+                        piece.u.data(), to, h.region);
+            offset[h.rank] += static_cast<int>(volume(h.region));
+        }
+    }
 }
 
 int main(int argc, char *argv[])
 {
-    MPI_Init(&argc, &argv);
+    // steps are read ahead in a background thread
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
 
     int rank, procs, wrank;
 
@@ -200,43 +456,199 @@ int main(int argc, char *argv[])
     size_t py = coords[1];
     size_t pz = coords[2];
 
-    if (argc < 4)
+    // --threads=T, --decomp=..., --encoding=..., --lod=..., --prefetch=P and
+    // --wait=... can be anywhere, the rest are positional arguments
+    std::vector<std::string> args;
+    int nthreads = 1;
+    std::string decomp = "blocks";
+    bool compact = false;
+    std::vector<int> lods;
+    int prefetch = 1;
+    WaitPolicy wait_policy;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg.compare(0, 10, "--threads=") == 0)
+        {
+            nthreads = std::max(1, std::stoi(arg.substr(10)));
+        }
+        else if (arg == "--decomp=blocks" || arg == "--decomp=writer" ||
+                 arg == "--decomp=box")
+        {
+            decomp = arg.substr(9);
+        }
+        else if (arg == "--encoding=plain" || arg == "--encoding=compact")
+        {
+            compact = (arg == "--encoding=compact");
+        }
+        else if (arg.compare(0, 6, "--lod=") == 0)
+        {
+            lods = parse_lod_sizes(arg.substr(6));
+        }
+        else if (arg.compare(0, 11, "--prefetch=") == 0)
+        {
+            prefetch = std::max(0, std::stoi(arg.substr(11)));
+        }
+        else if (parse_wait_option(arg, wait_policy))
+        {
+            // wait_policy is set
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    if (args.size() < 3)
     {
         if (rank == 0)
         {
             std::cerr << "Too few arguments" << std::endl;
-            std::cout << "Usage: isosurface input output isovalues..."
+            std::cout << "Usage: isosurface input output isovalues... "
+                         "[--threads=T] [--decomp=blocks|writer|box] "
+                         "[--encoding=plain|compact] [--lod=S[,S...]] "
+                         "[--prefetch=P] [--wait=I[:M[:F[:G]]]]"
+                      << std::endl;
+            std::cout << "  --threads=T: threads per process extracting the "
+                         "isosurfaces, default = 1"
+                      << std::endl;
+            std::cout << "  --decomp=blocks: read only the writer blocks "
+                         "with an isovalue in their"
+                      << std::endl;
+            std::cout << "          min/max, balanced over the processes "
+                         "(default); writer: the same"
+                      << std::endl;
+            std::cout << "          blocks whole, overlap exchanged "
+                         "between processes; box: a box"
+                      << std::endl;
+            std::cout << "          of the whole array per process"
+                      << std::endl;
+            std::cout << "  --encoding=compact: quantized points and normals, "
+                         "varint cells, default = plain"
+                      << std::endl;
+            std::cout << "  --lod=S,...: also coarser levels lod1/, lod2/, "
+                         "..., vertices clustered"
+                      << std::endl;
+            std::cout << "          in cells of S grid points, default = none"
+                      << std::endl;
+            std::cout << "  --prefetch=P: steps read ahead in the "
+                         "background, default = 1"
+                      << std::endl;
+            std::cout << "  --wait: BeginStep timeout from I to M seconds, "
+                         "growing by F, give up after G seconds,"
+                      << std::endl;
+            std::cout << "          default = 0.1:10:2:-1 (never)"
                       << std::endl;
         }
         MPI_Abort(MPI_COMM_WORLD, -1);
     }
 
-    const std::string input_fname(argv[1]);
-    const std::string output_fname(argv[2]);
+    const std::string input_fname(args[0]);
+    const std::string output_fname(args[1]);
 
     std::vector<double> isovalues;
-    for (int i = 3; i < argc; i++)
+    for (size_t i = 2; i < args.size(); i++)
     {
-        isovalues.push_back(std::stod(argv[i]));
+        isovalues.push_back(std::stod(args[i]));
     }
 
     adios2::ADIOS adios("adios2.xml", comm);
 
+    // The writer blocks with an isovalue assigned to this process, or its
+    // box of the whole array, each with one layer of overlap to the next
+    // parts. The box is the same for all steps. With --decomp=writer the
+    // blocks are read whole and the overlap is exchanged after the step.
+    auto read_input = [&](adios2::IO &io, adios2::Engine &reader,
+                          InputStep &in) {
+        adios2::Variable<double> varU = io.InquireVariable<double>("U");
+        adios2::Variable<int> varStep = io.InquireVariable<int>("step");
+
+        adios2::Dims shape = varU.Shape();
+        in.shape = shape;
+
+        std::vector<Box> boxes;
+        in.blocks = 0;
+        if (decomp == "writer" && io.EngineType() != "HDF5")
+        {
+            read_writer_blocks(reader, varU,
+                               reader.BlocksInfo(varU, reader.CurrentStep()),
+                               isovalues, rank, procs, in);
+            reader.Get<int>(varStep, &in.step);
+            return;
+        }
+        if (decomp == "blocks" && io.EngineType() != "HDF5")
+        {
+            auto blocks = reader.BlocksInfo(varU, reader.CurrentStep());
+            std::vector<Box> active;
+            if (active_blocks(blocks, isovalues, active))
+            {
+                in.blocks = blocks.size();
+                in.active_blocks = active.size();
+                boxes = assign_boxes(active, rank, procs);
+            }
+        }
+
+        if (!in.blocks)
+        {
+            size_t size_x = (shape[0] + npx - 1) / npx;
+            size_t size_y = (shape[1] + npy - 1) / npy;
+            size_t size_z = (shape[2] + npz - 1) / npz;
+
+            size_t offset_x = size_x * px;
+            size_t offset_y = size_y * py;
+            size_t offset_z = size_z * pz;
+
+            if (px == npx - 1)
+            {
+                size_x -= size_x * npx - shape[0];
+            }
+            if (py == npy - 1)
+            {
+                size_y -= size_y * npy - shape[1];
+            }
+            if (pz == npz - 1)
+            {
+                size_z -= size_z * npz - shape[2];
+            }
+
+            boxes.push_back(
+                {{offset_x, offset_y, offset_z}, {size_x, size_y, size_z}});
+        }
+
+        in.pieces.resize(boxes.size());
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            Piece &piece = in.pieces[i];
+            piece.start = boxes[i].first;
+            piece.count = boxes[i].second;
+            piece.own = boxes[i].second;
+            for (int d = 0; d < 3; ++d)
+            {
+                piece.count[d] =
+                    std::min(piece.count[d] + 1, shape[d] - piece.start[d]);
+            }
+            varU.SetSelection({piece.start, piece.count});
+            reader.Get<double>(varU, piece.u);
+        }
+        reader.Get<int>(varStep, &in.step);
+    };
+
     adios2::IO inIO = adios.DeclareIO("SimulationOutput");
-    adios2::Engine reader = inIO.Open(input_fname, adios2::Mode::Read);
+    StepReader<InputStep> reader(
+        inIO, input_fname, comm, read_input, prefetch, decomp == "box",
+        wait_policy,
+        decomp == "writer" ? exchange_halos
+                           : StepReader<InputStep>::ExchangeFunction());
 
     adios2::IO outIO = adios.DeclareIO("IsosurfaceOutput");
     adios2::Engine writer = outIO.Open(output_fname, adios2::Mode::Write);
 
-    auto varPoint =
-        outIO.DefineVariable<double>("point", {1, 3}, {0, 0}, {1, 3});
-    auto varCell = outIO.DefineVariable<int>("cell", {1, 3}, {0, 0}, {1, 3});
-    auto varNormal =
-        outIO.DefineVariable<double>("normal", {1, 3}, {0, 0}, {1, 3});
-    auto varOutStep = outIO.DefineVariable<int>("step");
+    MeshOutput out(outIO, compact, lods);
 
-    std::vector<double> u;
-    int step;
+    // for engines without spans, and the vertices shared between parts,
+    // reused for all steps
+    Mesh mesh;
+    Weld weld;
 
 #ifdef ENABLE_TIMERS
     Timer timer_total;
@@ -248,7 +660,8 @@ int main(int argc, char *argv[])
     log_fname << "isosurface_pe_" << rank << ".log";
 
     std::ofstream log(log_fname.str());
-    log << "step\ttotal_iso\tread_iso\tcompute_iso\twrite_iso" << std::endl;
+    log << "step\ttotal_iso\tread_iso\tcompute_iso\twrite_iso\twait_iso"
+        << std::endl;
 #endif
 
     while (true)
@@ -259,47 +672,12 @@ int main(int argc, char *argv[])
         timer_read.start();
 #endif
 
-        adios2::StepStatus status = reader.BeginStep();
-
-        if (status != adios2::StepStatus::OK)
+        InputStep *in = reader.next();
+        if (!in)
         {
             break;
         }
-
-        adios2::Variable<double> varU = inIO.InquireVariable<double>("U");
-        const adios2::Variable<int> varStep = inIO.InquireVariable<int>("step");
-
-        adios2::Dims shape = varU.Shape();
-
-        size_t size_x = (shape[0] + npx - 1) / npx;
-        size_t size_y = (shape[1] + npy - 1) / npy;
-        size_t size_z = (shape[2] + npz - 1) / npz;
-
-        size_t offset_x = size_x * px;
-        size_t offset_y = size_y * py;
-        size_t offset_z = size_z * pz;
-
-        if (px == npx - 1)
-        {
-            size_x -= size_x * npx - shape[0];
-        }
-        if (py == npy - 1)
-        {
-            size_y -= size_y * npy - shape[1];
-        }
-        if (pz == npz - 1)
-        {
-            size_z -= size_z * npz - shape[2];
-        }
-
-        varU.SetSelection({{offset_x, offset_y, offset_z},
-                           {size_x + (px != npx - 1 ? 1 : 0),
-                            size_y + (py != npy - 1 ? 1 : 0),
-                            size_z + (pz != npz - 1 ? 1 : 0)}});
-
-        reader.Get<double>(varU, u);
-        reader.Get<int>(varStep, step);
-        reader.EndStep();
+        const int step = in->step;
 
 #ifdef ENABLE_TIMERS
         double time_read = timer_read.stop();
@@ -307,15 +685,25 @@ int main(int argc, char *argv[])
         timer_compute.start();
 #endif
 
-        auto appendFilter = vtkSmartPointer<vtkAppendPolyData>::New();
-
-        for (const auto isovalue : isovalues)
+        if (!rank && in->blocks)
         {
-            auto polyData = compute_isosurface(varU, u, isovalue);
-            appendFilter->AddInputData(polyData);
+            std::cout << "isosurface at step " << step << " reading "
+                      << in->active_blocks << " of " << in->blocks
+                      << " blocks" << std::endl;
         }
 
-        appendFilter->Update();
+        // counts the mesh of each part, which is extracted into the output
+        // buffer, and finds the vertices it owns
+        std::vector<MarchingCubes<double>> parts;
+        parts.reserve(in->pieces.size());
+        weld.clear();
+        for (const auto &piece : in->pieces)
+        {
+            parts.emplace_back(piece.start, piece.count, piece.u.data(),
+                               isovalues, nthreads);
+            weld_part(weld, parts.back(), {piece.start, piece.own},
+                      in->shape);
+        }
 
 #ifdef ENABLE_TIMERS
         double time_compute = timer_compute.stop();
@@ -323,8 +711,7 @@ int main(int argc, char *argv[])
         timer_write.start();
 #endif
 
-        write_adios(writer, appendFilter->GetOutput(), varPoint, varCell,
-                    varNormal, varOutStep, step, comm);
+        write_isosurface(outIO, writer, parts, weld, mesh, out, step, comm);
 
 #ifdef ENABLE_TIMERS
         double time_write = timer_write.stop();
@@ -332,7 +719,8 @@ int main(int argc, char *argv[])
         MPI_Barrier(comm);
 
         log << step << "\t" << time_step << "\t" << time_read << "\t"
-            << time_compute << "\t" << time_write << std::endl;
+            << time_compute << "\t" << time_write << "\t"
+            << 1000.0 * reader.current_wait() << std::endl;
 #endif
     }
 
@@ -345,7 +733,11 @@ int main(int argc, char *argv[])
 #endif
 
     writer.Close();
-    reader.Close();
+    reader.close();
+    if (!rank)
+    {
+        reader.wait_stats().print_summary(std::cout, "isosurface");
+    }
 
     MPI_Finalize();
 }
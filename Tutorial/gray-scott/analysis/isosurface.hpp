@@ -0,0 +1,832 @@
+#ifndef __ISOSURFACE_HPP__
+#define __ISOSURFACE_HPP__
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <adios2.h>
+#include <mpi.h>
+
+#include "../common/mesh_encoding.hpp"
+#include "marching_cubes.hpp"
+
+/*
+ * Output of isosurfaces as the point, cell and normal arrays read by
+ * find_blobs and render_isosurface. Used by isosurface and analysis_host.
+ */
+
+using Box = adios2::Box<adios2::Dims>;
+
+/*
+ * Welding of the parts of a mesh into one without cracks. A vertex lies on
+ * an edge of the grid, and the parts next to each other both extract the
+ * vertices on the edges in the face between them. The part with the lower
+ * point of the edge in its own box, without the layer it shares with the
+ * next part, owns the vertex and writes it; the others use its global id.
+ */
+struct Weld
+{
+    enum Kind : char
+    {
+        Owned,    // only used by this process
+        Shared,   // owned, on a lower face of its part
+        Borrowed, // owned by another part
+    };
+
+    std::vector<uint64_t> keys; // edge keys of the vertices of the parts
+    std::vector<char> kinds;
+    std::vector<int> slots; // among the owned vertices, -1 if borrowed
+    std::vector<int> ids;   // global ids, see weld_ids()
+    int nowned = 0;
+    adios2::Dims shape; // of the array the keys are on
+
+    // own boxes of the parts and their first slots
+    std::vector<Box> boxes;
+    std::vector<int> first_slots;
+
+    void clear()
+    {
+        boxes.clear();
+        first_slots.clear();
+        keys.clear();
+        kinds.clear();
+        slots.clear();
+        ids.clear();
+        nowned = 0;
+    }
+};
+
+/*
+ * Variables of the isosurface output, plain or in the compact encoding of
+ * mesh_encoding.hpp, with the encoded arrays of this process kept until
+ * EndStep(). Coarser levels of detail, see decimate(), are written in the
+ * same step with the names prefixed by lod1/, lod2/, ...
+ */
+struct MeshOutput
+{
+    bool compact;
+    std::string prefix;
+    adios2::Variable<double> point;
+    adios2::Variable<int> cell;
+    adios2::Variable<double> normal;
+    adios2::Variable<int> point_box;
+    adios2::Variable<uint16_t> point_q;
+    adios2::Variable<int16_t> normal_oct;
+    adios2::Variable<uint8_t> cell_code;
+    adios2::Variable<int> step;
+
+    std::vector<int> boxes;
+    std::vector<uint16_t> q;
+    std::vector<int16_t> oct;
+    std::vector<uint8_t> code;
+
+    // the levels, each with its cluster size and its mesh and weld
+    std::vector<std::shared_ptr<MeshOutput>> lods;
+    int cluster = 0;
+    Mesh mesh;
+    Weld weld;
+
+    MeshOutput(adios2::IO &io, bool compact,
+               const std::vector<int> &clusters = {},
+               const std::string &prefix = "")
+    : compact(compact), prefix(prefix)
+    {
+        point = io.DefineVariable<double>(prefix + "point", {1, 3}, {0, 0},
+                                          {1, 3});
+        cell = io.DefineVariable<int>(prefix + "cell", {1, 3}, {0, 0}, {1, 3});
+        normal = io.DefineVariable<double>(prefix + "normal", {1, 3}, {0, 0},
+                                           {1, 3});
+        if (compact)
+        {
+            point_box = io.DefineVariable<int>(prefix + "point_box", {1, 7},
+                                               {0, 0}, {1, 7});
+            point_q = io.DefineVariable<uint16_t>(prefix + "point_q", {1, 3},
+                                                  {0, 0}, {1, 3});
+            normal_oct = io.DefineVariable<int16_t>(prefix + "normal_oct",
+                                                    {1, 2}, {0, 0}, {1, 2});
+            cell_code = io.DefineVariable<uint8_t>(prefix + "cell_code", {1},
+                                                   {0}, {1});
+        }
+        if (prefix.empty())
+        {
+            step = io.DefineVariable<int>("step");
+        }
+        for (size_t i = 0; i < clusters.size(); ++i)
+        {
+            lods.emplace_back(new MeshOutput(
+                io, compact, {}, "lod" + std::to_string(i + 1) + "/"));
+            lods.back()->cluster = clusters[i];
+        }
+    }
+};
+
+/*
+ * Cluster sizes of the levels of detail from a list like "2,4", each at
+ * least 1 grid point
+ */
+inline std::vector<int> parse_lod_sizes(const std::string &list)
+{
+    std::vector<int> sizes;
+    size_t pos = 0;
+    while (pos <= list.size())
+    {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos)
+        {
+            end = list.size();
+        }
+        const int size = std::stoi(list.substr(pos, end - pos));
+        if (size < 1)
+        {
+            throw std::invalid_argument(
+                "ERROR: the cluster sizes of the levels must be >= 1\n");
+        }
+        sizes.push_back(size);
+        pos = end + 1;
+    }
+    return sizes;
+}
+
+/*
+ * Shape and selection of a global array var[rows][width], or var[rows] if
+ * width is 0, with the rows of this process after those of the lower
+ * ranks; returns the first row of this process
+ */
+template <class T>
+size_t select_rows(adios2::Variable<T> &var, size_t rows, size_t width,
+                   MPI_Comm comm, size_t *total = nullptr)
+{
+    unsigned long long n = rows, sum, end;
+    MPI_Allreduce(&n, &sum, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+    MPI_Scan(&n, &end, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+    const size_t count = rows, first = end - n, all = sum;
+    if (!width)
+    {
+        var.SetShape({all});
+        var.SetSelection({{first}, {count}});
+    }
+    else
+    {
+        var.SetShape({all, all > 0 ? width : 0});
+        var.SetSelection({{first, 0}, {count, count > 0 ? width : 0}});
+    }
+    if (total)
+    {
+        *total = all;
+    }
+    return first;
+}
+
+/*
+ * Shapes and selections of the mesh variables in an output step for the
+ * points and cells of this process, which follow those of the lower ranks;
+ * returns the id of the first point of this process
+ */
+inline int select_mesh(int numPoints, int numCells, MeshOutput &out, int step,
+                       MPI_Comm comm)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    size_t totalPoints, totalCells;
+    const size_t firstPoint =
+        select_rows(out.point, numPoints, 3, comm, &totalPoints);
+    out.normal.SetShape(out.point.Shape());
+    out.normal.SetSelection({out.point.Start(), out.point.Count()});
+    select_rows(out.cell, numCells, 3, comm, &totalCells);
+
+    if (!rank)
+    {
+        const std::string level =
+            out.prefix.empty() ? ""
+                               : out.prefix.substr(0, out.prefix.size() - 1) +
+                                     " ";
+        std::cout << "isosurface " << level << "at step " << step
+                  << " writing out "
+                  << totalCells << " cells and " << totalPoints << " points"
+                  << std::endl;
+    }
+    return static_cast<int>(firstPoint);
+}
+
+/*
+ * Adds the vertices of the next part, with own box, of an array of the
+ * given shape
+ */
+template <class T>
+void weld_part(Weld &weld, const MarchingCubes<T> &mc, const Box &own,
+               const adios2::Dims &shape)
+{
+    weld.shape = shape;
+    weld.boxes.push_back(own);
+    weld.first_slots.push_back(weld.nowned);
+    const size_t first = weld.keys.size();
+    weld.keys.resize(first + mc.npoints());
+    mc.keys(shape, weld.keys.data() + first);
+    weld.kinds.resize(weld.keys.size());
+    weld.slots.resize(weld.keys.size());
+
+    const uint64_t size = shape[0] * shape[1] * shape[2];
+    for (size_t v = first; v < weld.keys.size(); ++v)
+    {
+        // the lower point of the edge in (z, y, x) and the dimension of
+        // the edge
+        const uint64_t point = (weld.keys[v] / 3) % size;
+        const size_t p[3] = {point / (shape[1] * shape[2]),
+                             point / shape[2] % shape[1], point % shape[2]};
+        const int axis = 2 - static_cast<int>(weld.keys[v] % 3);
+
+        bool inside = true, lower = false;
+        for (int d = 0; d < 3; ++d)
+        {
+            inside = inside && p[d] >= own.first[d] &&
+                     p[d] < own.first[d] + own.second[d];
+            lower = lower || (p[d] == own.first[d] && p[d] > 0 && d != axis);
+        }
+        if (inside)
+        {
+            weld.kinds[v] = lower ? Weld::Shared : Weld::Owned;
+            weld.slots[v] = weld.nowned++;
+        }
+        else
+        {
+            weld.kinds[v] = Weld::Borrowed;
+            weld.slots[v] = -1;
+        }
+    }
+}
+
+/*
+ * Global ids of the vertices, with those owned by this process from
+ * firstPoint on. The owners of shared vertices publish their ids at a home
+ * process given by the key, where the processes borrowing them look them up.
+ */
+inline void weld_ids(Weld &weld, int firstPoint, MPI_Comm comm)
+{
+    int nproc;
+    MPI_Comm_size(comm, &nproc);
+    auto home = [nproc](uint64_t key) {
+        return static_cast<int>(((key * 0x9E3779B97F4A7C15ull) >> 32) %
+                                static_cast<uint64_t>(nproc));
+    };
+
+    const size_t n = weld.keys.size();
+    weld.ids.resize(n);
+
+    // [key, id] pairs published and keys looked up, by home process
+    std::vector<std::vector<uint64_t>> publish(nproc), lookup(nproc);
+    std::vector<std::vector<size_t>> borrowed(nproc);
+    for (size_t v = 0; v < n; ++v)
+    {
+        const uint64_t key = weld.keys[v];
+        if (weld.kinds[v] == Weld::Borrowed)
+        {
+            lookup[home(key)].push_back(key);
+            borrowed[home(key)].push_back(v);
+            continue;
+        }
+        weld.ids[v] = firstPoint + weld.slots[v];
+        if (weld.kinds[v] == Weld::Shared)
+        {
+            publish[home(key)].push_back(key);
+            publish[home(key)].push_back(weld.ids[v]);
+        }
+    }
+
+    // all-to-all exchange of the lists, into one list by source process
+    // with its counts and displacements
+    auto exchange = [&](const std::vector<std::vector<uint64_t>> &lists,
+                        std::vector<uint64_t> &recv, std::vector<int> &rcounts,
+                        std::vector<int> &rdispls) {
+        std::vector<int> scounts(nproc), sdispls(nproc);
+        std::vector<uint64_t> send;
+        for (int r = 0; r < nproc; ++r)
+        {
+            scounts[r] = static_cast<int>(lists[r].size());
+            sdispls[r] = static_cast<int>(send.size());
+            send.insert(send.end(), lists[r].begin(), lists[r].end());
+        }
+        rcounts.resize(nproc);
+        rdispls.resize(nproc);
+        MPI_Alltoall(scounts.data(), 1, MPI_INT, rcounts.data(), 1, MPI_INT,
+                     comm);
+        int total = 0;
+        for (int r = 0; r < nproc; ++r)
+        {
+            rdispls[r] = total;
+            total += rcounts[r];
+        }
+        recv.resize(total);
+        MPI_Alltoallv(send.data(), scounts.data(), sdispls.data(),
+                      MPI_UINT64_T, recv.data(), rcounts.data(),
+                      rdispls.data(), MPI_UINT64_T, comm);
+    };
+
+    std::vector<uint64_t> published, requested;
+    std::vector<int> counts, displs;
+    exchange(publish, published, counts, displs);
+    std::unordered_map<uint64_t, uint64_t> home_ids(published.size() / 2);
+    for (size_t i = 0; i + 1 < published.size(); i += 2)
+    {
+        home_ids[published[i]] = published[i + 1];
+    }
+
+    exchange(lookup, requested, counts, displs);
+    std::vector<std::vector<uint64_t>> answers(nproc);
+    for (int r = 0; r < nproc; ++r)
+    {
+        for (int i = displs[r]; i < displs[r] + counts[r]; ++i)
+        {
+            auto it = home_ids.find(requested[i]);
+            if (it == home_ids.end())
+            {
+                throw std::logic_error(
+                    "ERROR: a vertex of the isosurface has no owner\n");
+            }
+            answers[r].push_back(it->second);
+        }
+    }
+
+    std::vector<uint64_t> found;
+    exchange(answers, found, counts, displs);
+    for (int r = 0; r < nproc; ++r)
+    {
+        for (int i = 0; i < counts[r]; ++i)
+        {
+            weld.ids[borrowed[r][i]] = static_cast<int>(found[displs[r] + i]);
+        }
+    }
+}
+
+/*
+ * Puts the mesh of this process, with its owned points from firstPoint on,
+ * in the compact encoding
+ */
+inline void put_compact(adios2::Engine &writer, MeshOutput &out,
+                        const Weld &weld, int firstPoint,
+                        const double *points, const double *normals,
+                        const int *cells, size_t numPoints, size_t numCells,
+                        MPI_Comm comm)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    // the points of each part in its own box, in x, y, z
+    out.boxes.clear();
+    out.q.resize(3 * numPoints);
+    for (size_t p = 0; p < weld.boxes.size(); ++p)
+    {
+        const int first = weld.first_slots[p];
+        const int last = p + 1 < weld.boxes.size() ? weld.first_slots[p + 1]
+                                                   : weld.nowned;
+        if (first == last)
+        {
+            continue;
+        }
+        const Box &own = weld.boxes[p];
+        int box[7] = {firstPoint + first};
+        for (int d = 0; d < 3; ++d)
+        {
+            box[1 + d] = static_cast<int>(own.first[2 - d]);
+            box[4 + d] = static_cast<int>(own.first[2 - d] + own.second[2 - d]);
+        }
+        out.boxes.insert(out.boxes.end(), box, box + 7);
+        encode_points(points + 3 * first, last - first, box + 1,
+                      out.q.data() + 3 * first);
+    }
+    out.oct.resize(2 * numPoints);
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        encode_normal(normals + 3 * i, out.oct.data() + 2 * i);
+    }
+
+    // the code of the cells continues from the last point id of the
+    // highest lower rank with cells
+    struct
+    {
+        int rank;
+        int id;
+    } last = {numCells ? rank : -1, numCells ? cells[3 * numCells - 1] : 0},
+      below = {-1, 0};
+    MPI_Exscan(&last, &below, 1, MPI_2INT, MPI_MAXLOC, comm);
+    out.code.clear();
+    encode_cells(cells, 3 * numCells, rank && below.rank >= 0 ? below.id : 0,
+                 out.code);
+
+    select_rows(out.point_box, out.boxes.size() / 7, 7, comm);
+    select_rows(out.point_q, numPoints, 3, comm);
+    select_rows(out.normal_oct, numPoints, 2, comm);
+    select_rows(out.cell_code, out.code.size(), 0, comm);
+    if (numPoints)
+    {
+        writer.Put(out.point_box, out.boxes.data());
+        writer.Put(out.point_q, out.q.data());
+        writer.Put(out.normal_oct, out.oct.data());
+    }
+    if (numCells)
+    {
+        writer.Put(out.cell_code, out.code.data());
+    }
+}
+
+/*
+ * A coarser level of detail of a mesh by vertex clustering: the vertices of
+ * a part in the same cell of a grid with cells of the given size, for the
+ * same isovalue, merge into their mean, and the triangles left with less
+ * than three vertices are dropped. The vertices shared with other parts and
+ * those on the boundary of the array stay where they are, so the levels of
+ * all parts fit together as the full meshes do.
+ *
+ * mesh has the owned vertices of weld from firstPoint on and the global ids
+ * in its cells, as given to put_mesh(). lod gets the owned vertices of the
+ * level, its cells the vertices of lweld, whose ids come from weld_ids().
+ */
+inline void decimate(const Weld &weld, int firstPoint, const Mesh &mesh,
+                     int size, Mesh &lod, Weld &lweld)
+{
+    const adios2::Dims &shape = weld.shape;
+    const uint64_t npoints = shape[0] * shape[1] * shape[2];
+    // clusters in x, y, z
+    const uint64_t nclusters[3] = {shape[2] / size + 1, shape[1] / size + 1,
+                                   shape[0] / size + 1};
+
+    // keys and kinds of the owned vertices by slot, and the keys of the
+    // borrowed ones by global id
+    std::vector<uint64_t> keys(weld.nowned);
+    std::vector<char> kinds(weld.nowned);
+    std::unordered_map<int, uint64_t> borrowed_keys;
+    for (size_t v = 0; v < weld.keys.size(); ++v)
+    {
+        if (weld.slots[v] >= 0)
+        {
+            keys[weld.slots[v]] = weld.keys[v];
+            kinds[weld.slots[v]] = weld.kinds[v];
+        }
+        else
+        {
+            borrowed_keys[weld.ids[v]] = weld.keys[v];
+        }
+    }
+
+    lweld.clear();
+    lweld.shape = shape;
+    lod.points.clear();
+    lod.normals.clear();
+    lod.cells.clear();
+    lod.first_point.clear();
+
+    // the vertex of the level of each slot, and the members of the
+    // vertices of the level
+    std::vector<int> vertex(weld.nowned);
+    std::vector<int> members;
+    std::unordered_map<uint64_t, int> clusters;
+    for (size_t p = 0; p < weld.boxes.size(); ++p)
+    {
+        const int first = weld.first_slots[p];
+        const int last = p + 1 < weld.boxes.size() ? weld.first_slots[p + 1]
+                                                   : weld.nowned;
+        const int firstVertex = lweld.nowned;
+        clusters.clear();
+        for (int s = first; s < last; ++s)
+        {
+            const uint64_t key = keys[s];
+            const uint64_t point = (key / 3) % npoints;
+            const size_t q[3] = {point / (shape[1] * shape[2]),
+                                 point / shape[2] % shape[1],
+                                 point % shape[2]};
+            const int axis = 2 - static_cast<int>(key % 3);
+            bool fixed = kinds[s] == Weld::Shared;
+            for (int d = 0; d < 3; ++d)
+            {
+                fixed = fixed ||
+                        (d != axis && (q[d] == 0 || q[d] + 1 == shape[d]));
+            }
+
+            const double *x = mesh.points.data() + 3 * s;
+            const double *n = mesh.normals.data() + 3 * s;
+            if (!fixed)
+            {
+                uint64_t cluster = key / 3 / npoints;
+                for (int d = 0; d < 3; ++d)
+                {
+                    cluster = cluster * nclusters[d] +
+                              static_cast<uint64_t>(x[d] / size);
+                }
+                auto it = clusters.emplace(cluster, lweld.nowned);
+                if (!it.second)
+                {
+                    const int c = it.first->second;
+                    vertex[s] = c;
+                    ++members[c];
+                    for (int d = 0; d < 3; ++d)
+                    {
+                        lod.points[3 * c + d] += x[d];
+                        lod.normals[3 * c + d] += n[d];
+                    }
+                    continue;
+                }
+            }
+            vertex[s] = lweld.nowned;
+            lweld.keys.push_back(key);
+            lweld.kinds.push_back(fixed ? kinds[s]
+                                        : static_cast<char>(Weld::Owned));
+            lweld.slots.push_back(lweld.nowned++);
+            members.push_back(1);
+            lod.points.insert(lod.points.end(), x, x + 3);
+            lod.normals.insert(lod.normals.end(), n, n + 3);
+        }
+
+        lweld.boxes.push_back(weld.boxes[p]);
+        lweld.first_slots.push_back(firstVertex);
+    }
+
+    for (int c = 0; c < lweld.nowned; ++c)
+    {
+        double *x = lod.points.data() + 3 * c;
+        double *n = lod.normals.data() + 3 * c;
+        double len = 0.0;
+        for (int d = 0; d < 3; ++d)
+        {
+            x[d] /= members[c];
+            len += n[d] * n[d];
+        }
+        len = std::sqrt(len);
+        for (int d = 0; d < 3; ++d)
+        {
+            n[d] = len > 0.0 ? n[d] / len : 0.0;
+        }
+    }
+
+    // the triangles with three distinct vertices, the borrowed vertices
+    // added as they are used
+    std::unordered_map<int, int> borrowed;
+    std::vector<char> used(lweld.nowned, 0);
+    for (size_t i = 0; i + 2 < mesh.cells.size(); i += 3)
+    {
+        int t[3];
+        for (int k = 0; k < 3; ++k)
+        {
+            const int id = mesh.cells[i + k];
+            if (id >= firstPoint && id < firstPoint + weld.nowned)
+            {
+                t[k] = vertex[id - firstPoint];
+                continue;
+            }
+            auto it = borrowed.find(id);
+            if (it == borrowed.end())
+            {
+                it = borrowed.emplace(id, lweld.keys.size()).first;
+                lweld.keys.push_back(borrowed_keys.at(id));
+                lweld.kinds.push_back(Weld::Borrowed);
+                lweld.slots.push_back(-1);
+            }
+            t[k] = it->second;
+        }
+        if (t[0] == t[1] || t[1] == t[2] || t[2] == t[0])
+        {
+            continue;
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+            if (t[k] < lweld.nowned)
+            {
+                used[t[k]] = 1;
+            }
+        }
+        lod.cells.insert(lod.cells.end(), t, t + 3);
+    }
+
+    // drop the vertices no triangle uses any more, but those other parts
+    // can use
+    std::vector<int> moved(lweld.keys.size());
+    int nowned = 0;
+    size_t p = 0;
+    for (int v = 0; v < lweld.nowned; ++v)
+    {
+        while (p < lweld.first_slots.size() && lweld.first_slots[p] == v)
+        {
+            lweld.first_slots[p++] = nowned;
+        }
+        if (!used[v] && lweld.kinds[v] != Weld::Shared)
+        {
+            moved[v] = -1;
+            continue;
+        }
+        moved[v] = nowned;
+        lweld.keys[nowned] = lweld.keys[v];
+        lweld.kinds[nowned] = lweld.kinds[v];
+        lweld.slots[nowned] = nowned;
+        std::copy_n(lod.points.begin() + 3 * v, 3,
+                    lod.points.begin() + 3 * nowned);
+        std::copy_n(lod.normals.begin() + 3 * v, 3,
+                    lod.normals.begin() + 3 * nowned);
+        ++nowned;
+    }
+    for (; p < lweld.first_slots.size(); ++p)
+    {
+        lweld.first_slots[p] = nowned;
+    }
+    for (size_t v = lweld.nowned; v < lweld.keys.size(); ++v)
+    {
+        moved[v] = static_cast<int>(v) - lweld.nowned + nowned;
+        lweld.keys[moved[v]] = lweld.keys[v];
+        lweld.kinds[moved[v]] = lweld.kinds[v];
+        lweld.slots[moved[v]] = -1;
+    }
+    const size_t nvertices = lweld.keys.size() - lweld.nowned + nowned;
+    lweld.keys.resize(nvertices);
+    lweld.kinds.resize(nvertices);
+    lweld.slots.resize(nvertices);
+    lweld.nowned = nowned;
+    lod.points.resize(3 * nowned);
+    lod.normals.resize(3 * nowned);
+    for (auto &v : lod.cells)
+    {
+        v = moved[v];
+    }
+}
+
+/*
+ * Puts the mesh of this process in the encoding of out, and its levels of
+ * detail
+ */
+inline void put_mesh(adios2::Engine &writer, MeshOutput &out,
+                     const Weld &weld, int firstPoint, const Mesh &mesh,
+                     int step, MPI_Comm comm)
+{
+    const size_t numPoints = mesh.npoints(), numCells = mesh.ncells();
+    if (out.compact)
+    {
+        put_compact(writer, out, weld, firstPoint, mesh.points.data(),
+                    mesh.normals.data(), mesh.cells.data(), numPoints,
+                    numCells, comm);
+    }
+    else
+    {
+        if (numPoints)
+        {
+            writer.Put(out.point, mesh.points.data());
+            writer.Put(out.normal, mesh.normals.data());
+        }
+        if (numCells)
+        {
+            writer.Put(out.cell, mesh.cells.data());
+        }
+    }
+
+    for (auto &level : out.lods)
+    {
+        decimate(weld, firstPoint, mesh, level->cluster, level->mesh,
+                 level->weld);
+        const int first = select_mesh(level->weld.nowned,
+                                      level->mesh.ncells(), *level, step, comm);
+        weld_ids(level->weld, first, comm);
+        for (auto &id : level->mesh.cells)
+        {
+            id = level->weld.ids[id];
+        }
+        put_mesh(writer, *level, level->weld, first, level->mesh, step, comm);
+    }
+}
+
+/*
+ * One output step of the meshes of all processes, with the vertices of
+ * mesh given by weld. mesh keeps only the owned vertices, and its cells
+ * get the global point ids.
+ */
+inline void write_mesh(adios2::Engine &writer, Mesh &mesh, Weld &weld,
+                       MeshOutput &out, int step, MPI_Comm comm)
+{
+    writer.BeginStep();
+    const int firstPoint =
+        select_mesh(weld.nowned, mesh.ncells(), out, step, comm);
+    weld_ids(weld, firstPoint, comm);
+
+    // the owned vertices move to their slots, never after their place
+    for (size_t v = 0; v < weld.slots.size(); ++v)
+    {
+        const int s = weld.slots[v];
+        if (s >= 0)
+        {
+            std::copy_n(mesh.points.begin() + 3 * v, 3,
+                        mesh.points.begin() + 3 * s);
+            std::copy_n(mesh.normals.begin() + 3 * v, 3,
+                        mesh.normals.begin() + 3 * s);
+        }
+    }
+    mesh.points.resize(3 * weld.nowned);
+    mesh.normals.resize(3 * weld.nowned);
+    // the first points of the isovalues no longer apply
+    mesh.first_point.clear();
+    for (auto &id : mesh.cells)
+    {
+        id = weld.ids[id];
+    }
+
+    put_mesh(writer, out, weld, firstPoint, mesh, step, comm);
+    writer.Put(out.step, step);
+    writer.EndStep();
+}
+
+/*
+ * Whether the engine of io gives spans of its buffer from Put: the BP
+ * engines and their aliases, with the default engine being BP4 or BP5. BP5
+ * has spans since ADIOS2 2.9; SST, HDF5 and the others have none.
+ */
+inline bool has_spans(adios2::IO &io)
+{
+    std::string type = io.EngineType();
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+    if (type == "bp5")
+    {
+#if defined(ADIOS2_VERSION_MAJOR) && defined(ADIOS2_VERSION_MINOR)
+        return ADIOS2_VERSION_MAJOR > 2 || ADIOS2_VERSION_MINOR >= 9;
+#else
+        return false;
+#endif
+    }
+    return type.empty() || type == "bp" || type == "bp3" || type == "bp4" ||
+           type == "bpfile" || type == "file" || type == "filestream";
+}
+
+/*
+ * One output step of the isosurfaces of all processes, from the parts of
+ * this process and their weld. The mesh is sized first and then extracted
+ * straight into the buffer of the engine, only the owned vertices and with
+ * the global point ids in the cells; engines without spans, and the compact
+ * encoding and levels of detail, get it from buffer. io is the IO writer
+ * was opened from.
+ */
+template <class T>
+void write_isosurface(adios2::IO &io, adios2::Engine &writer,
+                      const std::vector<MarchingCubes<T>> &parts, Weld &weld,
+                      Mesh &buffer, MeshOutput &out, int step, MPI_Comm comm)
+{
+    size_t numCells = 0;
+    for (const auto &mc : parts)
+    {
+        numCells += mc.ncells();
+    }
+    const size_t numPoints = weld.nowned;
+
+    writer.BeginStep();
+    const int firstPoint =
+        select_mesh(static_cast<int>(numPoints), static_cast<int>(numCells),
+                    out, step, comm);
+    weld_ids(weld, firstPoint, comm);
+
+    // the parts one after the other, the vertices into their slots
+    auto extract = [&](double *points, double *normals, int *cells) {
+        size_t v = 0;
+        for (const auto &mc : parts)
+        {
+            mc.extract(points, normals, cells, 0, weld.slots.data() + v,
+                       weld.ids.data() + v);
+            cells += 3 * mc.ncells();
+            v += mc.npoints();
+        }
+    };
+
+    if (out.compact || !out.lods.empty() || !has_spans(io))
+    {
+        buffer.points.resize(3 * numPoints);
+        buffer.normals.resize(3 * numPoints);
+        buffer.cells.resize(3 * numCells);
+        extract(buffer.points.data(), buffer.normals.data(),
+                buffer.cells.data());
+        put_mesh(writer, out, weld, firstPoint, buffer, step, comm);
+    }
+    else
+    {
+        // a process can have triangles but no owned vertices, or owned
+        // vertices used only by the triangles of other parts
+        std::vector<adios2::Variable<double>::Span> spanPoints;
+        std::vector<adios2::Variable<int>::Span> spanCells;
+        if (numPoints)
+        {
+            spanPoints.push_back(writer.Put(out.point));
+            spanPoints.push_back(writer.Put(out.normal));
+        }
+        if (numCells)
+        {
+            spanCells.push_back(writer.Put(out.cell));
+        }
+        // the buffer can grow while spans are added, so the pointers are
+        // taken after the last one
+        extract(numPoints ? spanPoints[0].data() : nullptr,
+                numPoints ? spanPoints[1].data() : nullptr,
+                numCells ? spanCells[0].data() : nullptr);
+    }
+    writer.Put(out.step, step);
+    writer.EndStep();
+}
+
+#endif
@@ -0,0 +1,661 @@
+#ifndef __MARCHING_CUBES_HPP__
+#define __MARCHING_CUBES_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+/*
+ * Isosurfaces of a block of a 3D array with marching cubes, for several
+ * isovalues in one sweep over the block and with several threads, without
+ * VTK. Used by isosurface and analysis_host.
+ *
+ * The block is array[nx][ny][nz] of the points start + (i, j, k); as with
+ * vtkImageImport, the coordinates of a point are (k, j, i) + (start[2],
+ * start[1], start[0]), so the last index is x.
+ *
+ * Each edge of the grid that crosses an isovalue gets one vertex, shared by
+ * all the cubes around it, so the mesh is watertight inside the block. The
+ * triangles are oriented so that they face lower values, as the normals,
+ * which are the interpolated negative gradients.
+ */
+
+/*
+ * Mesh as flat arrays in the output layout: points and normals are x, y, z
+ * of each vertex, cells are the vertex ids of each triangle. The vertices
+ * and triangles of isovalue n are [first_point[n], first_point[n + 1]) and
+ * [first_cell[n], first_cell[n + 1]).
+ */
+struct Mesh
+{
+    std::vector<double> points;
+    std::vector<double> normals;
+    std::vector<int> cells;
+    std::vector<size_t> first_point;
+    std::vector<size_t> first_cell;
+
+    size_t npoints() const { return points.size() / 3; }
+    size_t ncells() const { return cells.size() / 3; }
+
+    void clear()
+    {
+        points.clear();
+        normals.clear();
+        cells.clear();
+        first_point.clear();
+        first_cell.clear();
+    }
+};
+
+/*
+ * Triangles of each of the 256 cases of the corners of a cube above the
+ * isovalue, as triples of cube edges.
+ *
+ * Corner c of a cube is at (c & 1, c >> 1 & 1, c >> 2 & 1) in x, y, z; edge
+ * 4 * a + m is the m-th edge along axis a. The table is built from the
+ * faces: on each face the crossed edges are joined around the corners above
+ * the isovalue, and where two diagonal corners are above, these are kept
+ * apart. Since this depends only on the face, neighboring cubes agree and
+ * there are no cracks. The joined edges form closed polygons, which are
+ * split into triangles.
+ */
+class MarchingCubesTable
+{
+public:
+    struct Case
+    {
+        int ntriangles;
+        int8_t edges[36];
+    };
+
+    static const MarchingCubesTable &get()
+    {
+        static const MarchingCubesTable table;
+        return table;
+    }
+
+    const Case &operator[](int index) const { return cases[index]; }
+
+    // corners of the cube edges, lower one first
+    int edge_corner[12][2];
+
+private:
+    Case cases[256];
+
+    // whether two cube edges are on one face
+    bool same_face(int e0, int e1) const
+    {
+        const int c[4] = {edge_corner[e0][0], edge_corner[e0][1],
+                          edge_corner[e1][0], edge_corner[e1][1]};
+        for (int a = 0; a < 3; ++a)
+        {
+            int n = 0;
+            for (int m = 0; m < 4; ++m)
+            {
+                n += c[m] >> a & 1;
+            }
+            if (n == 0 || n == 4)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    MarchingCubesTable()
+    {
+        int edge_of[8][8];
+        for (int a = 0; a < 3; ++a)
+        {
+            int m = 0;
+            for (int c = 0; c < 8; ++c)
+            {
+                if (!(c >> a & 1))
+                {
+                    const int e = 4 * a + m++;
+                    edge_corner[e][0] = c;
+                    edge_corner[e][1] = c | 1 << a;
+                    edge_of[c][c | 1 << a] = e;
+                    edge_of[c | 1 << a][c] = e;
+                }
+            }
+        }
+
+        // corners of the faces, counterclockwise seen from outside
+        int face[6][4];
+        for (int a = 0; a < 3; ++a)
+        {
+            const int b = (a + 1) % 3;
+            const int d = (a + 2) % 3;
+            for (int s = 0; s < 2; ++s)
+            {
+                const int uv[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+                for (int n = 0; n < 4; ++n)
+                {
+                    // the face at 0 is seen from the other side
+                    const int p = s ? n : 3 - n;
+                    face[2 * a + s][n] =
+                        s << a | uv[p][0] << b | uv[p][1] << d;
+                }
+            }
+        }
+
+        for (int index = 0; index < 256; ++index)
+        {
+            // next edge of the polygons: from where a face is entered above
+            // the isovalue, walking counterclockwise, to where it is left
+            int next[12];
+            std::fill(next, next + 12, -1);
+            for (int f = 0; f < 6; ++f)
+            {
+                bool above[4];
+                for (int n = 0; n < 4; ++n)
+                {
+                    above[n] = index >> face[f][n] & 1;
+                }
+                for (int n = 0; n < 4; ++n)
+                {
+                    if (above[n] || !above[(n + 1) % 4])
+                    {
+                        continue;
+                    }
+                    int m = (n + 1) % 4;
+                    while (!above[m] || above[(m + 1) % 4])
+                    {
+                        m = (m + 1) % 4;
+                    }
+                    next[edge_of[face[f][n]][face[f][(n + 1) % 4]]] =
+                        edge_of[face[f][m]][face[f][(m + 1) % 4]];
+                }
+            }
+
+            Case &cs = cases[index];
+            cs.ntriangles = 0;
+            bool done[12] = {false};
+            for (int e = 0; e < 12; ++e)
+            {
+                if (next[e] < 0 || done[e])
+                {
+                    continue;
+                }
+                std::vector<int> polygon;
+                for (int p = e; !done[p]; p = next[p])
+                {
+                    done[p] = true;
+                    polygon.push_back(p);
+                }
+                // fan from a vertex whose diagonals do not lie in a face,
+                // where the neighboring cube could have them as well
+                const size_t np = polygon.size();
+                size_t apex = 0;
+                for (size_t r = 0; r < np; ++r)
+                {
+                    bool ok = true;
+                    for (size_t n = 2; n + 1 < np; ++n)
+                    {
+                        ok = ok && !same_face(polygon[r],
+                                              polygon[(r + n) % np]);
+                    }
+                    if (ok)
+                    {
+                        apex = r;
+                        break;
+                    }
+                }
+                for (size_t n = 1; n + 1 < np; ++n)
+                {
+                    int8_t *t = cs.edges + 3 * cs.ntriangles++;
+                    t[0] = static_cast<int8_t>(polygon[apex]);
+                    t[1] = static_cast<int8_t>(polygon[(apex + n) % np]);
+                    t[2] = static_cast<int8_t>(polygon[(apex + n + 1) % np]);
+                }
+            }
+        }
+    }
+};
+
+/*
+ * Isosurfaces of array[count[0]][count[1]][count[2]] at start for all
+ * isovalues, with nthreads threads.
+ *
+ * The constructor counts the vertices of each layer in z and the triangles
+ * between each two layers, so their total is known before any is made.
+ * extract() then writes every part of the mesh straight at its place in the
+ * output arrays, which can be those of the engine (ADIOS spans). Each thread
+ * takes a range of layers and keeps the vertex ids of the edges of the
+ * current and the next layer for each isovalue, so each vertex is
+ * interpolated once; all isovalues are done layer by layer. The field must
+ * stay valid until then.
+ */
+template <class T>
+class MarchingCubes
+{
+public:
+    MarchingCubes(const std::vector<size_t> &start,
+                  const std::vector<size_t> &count, const T *field,
+                  const std::vector<double> &isovalues, int nthreads = 1)
+    : table(MarchingCubesTable::get()), start(start), field(field),
+      isovalues(isovalues), niso(isovalues.size()), nx(count[0]),
+      ny(count[1]), nz(count[2]), layer(ny * nz),
+      first_points(niso + 1, 0), first_cells(niso + 1, 0)
+    {
+        if (nx < 2 || ny < 2 || nz < 2 || !niso)
+        {
+            this->nthreads = 0;
+            return;
+        }
+        this->nthreads = static_cast<int>(
+            std::max<size_t>(1, std::min<size_t>(nthreads, nx - 1)));
+
+        for (int c = 0; c < 8; ++c)
+        {
+            corner_offset[c] =
+                (c >> 2 & 1) * layer + (c >> 1 & 1) * nz + (c & 1);
+        }
+        for (int e = 0; e < 12; ++e)
+        {
+            edge_axis[e] = e / 4;
+            edge_origin[e] = corner_offset[table.edge_corner[e][0]];
+        }
+        edge_step[0] = 1;
+        edge_step[1] = nz;
+        edge_step[2] = layer;
+
+        std::vector<size_t> nvertices(niso * nx, 0);
+        std::vector<size_t> ntriangles(niso * nx, 0);
+        run([&](int t) { count_layers(t, nvertices, ntriangles); });
+
+        // offsets of the layers in the mesh, isovalue by isovalue
+        vertex_offset.resize(niso * nx);
+        triangle_offset.resize(niso * nx);
+        size_t nv = 0, nt = 0;
+        for (size_t n = 0; n < niso; ++n)
+        {
+            first_points[n] = nv;
+            first_cells[n] = nt;
+            for (size_t i = 0; i < nx; ++i)
+            {
+                vertex_offset[n * nx + i] = nv;
+                triangle_offset[n * nx + i] = nt;
+                nv += nvertices[n * nx + i];
+                nt += ntriangles[n * nx + i];
+            }
+        }
+        first_points[niso] = nv;
+        first_cells[niso] = nt;
+    }
+
+    size_t npoints() const { return first_points[niso]; }
+    size_t ncells() const { return first_cells[niso]; }
+
+    // first vertex and triangle of each isovalue, and the totals
+    const std::vector<size_t> &first_point() const { return first_points; }
+    const std::vector<size_t> &first_cell() const { return first_cells; }
+
+    /*
+     * The mesh into points[3 * npoints()], normals[3 * npoints()] and
+     * cells[3 * ncells()], with point_offset added to the vertex ids of the
+     * cells. With slot and ids, vertex v goes to slot[v] of points and
+     * normals, or nowhere if slot[v] < 0, and is ids[v] in the cells.
+     */
+    void extract(double *points, double *normals, int *cells,
+                 int point_offset = 0, const int *slot = nullptr,
+                 const int *ids = nullptr) const
+    {
+        if (!npoints() && !ncells())
+        {
+            return;
+        }
+        run([&](int t) {
+            generate(t, points, normals, cells, point_offset, slot, ids);
+        });
+    }
+
+    /*
+     * Keys of the vertices in the order of extract(), the same in all
+     * blocks of an array of the given shape: the isovalue and the edge of
+     * the grid, from its lower point along x, y or z
+     */
+    void keys(const std::vector<size_t> &shape, uint64_t *keys) const
+    {
+        if (!npoints())
+        {
+            return;
+        }
+        const uint64_t size = shape[0] * shape[1] * shape[2];
+        run([&](int t) {
+            size_t c0, c1;
+            layers(t, c0, c1);
+            const size_t p1 = (c1 == nx - 1) ? nx : c1;
+            std::vector<int> ids(3 * layer);
+            for (size_t n = 0; n < niso; ++n)
+            {
+                for (size_t i = c0; i < p1; ++i)
+                {
+                    crossings(i, isovalues[n], ids.data());
+                    uint64_t *key = keys + vertex_offset[n * nx + i];
+                    for (size_t j = 0; j < ny; ++j)
+                    {
+                        for (size_t k = 0; k < nz; ++k)
+                        {
+                            const uint64_t point =
+                                ((start[0] + i) * shape[1] + start[1] + j) *
+                                    shape[2] +
+                                start[2] + k;
+                            const int *id = ids.data() + 3 * (j * nz + k);
+                            for (int a = 0; a < 3; ++a)
+                            {
+                                if (id[a] >= 0)
+                                {
+                                    key[id[a]] = (n * size + point) * 3 + a;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+private:
+    const MarchingCubesTable &table;
+    std::vector<size_t> start;
+    const T *field;
+    std::vector<double> isovalues;
+    size_t niso, nx, ny, nz, layer;
+    int nthreads;
+
+    // grid offsets of the corners and directions of the edges of a cube
+    size_t corner_offset[8];
+    int edge_axis[12];
+    size_t edge_origin[12];
+    size_t edge_step[3];
+
+    // [iso][layer]
+    std::vector<size_t> vertex_offset;
+    std::vector<size_t> triangle_offset;
+    std::vector<size_t> first_points;
+    std::vector<size_t> first_cells;
+
+    void run(const std::function<void(int)> &fn) const
+    {
+        std::vector<std::thread> threads;
+        for (int t = 1; t < nthreads; ++t)
+        {
+            threads.emplace_back(fn, t);
+        }
+        fn(0);
+        for (auto &th : threads)
+        {
+            th.join();
+        }
+    }
+
+    // range of layers of a thread: cells between layers [c0, c1), and the
+    // vertices of the same layers, the last thread also of layer nx - 1
+    void layers(int t, size_t &c0, size_t &c1) const
+    {
+        c0 = (nx - 1) * t / nthreads;
+        c1 = (nx - 1) * (t + 1) / nthreads;
+    }
+
+    double value(size_t i, size_t j, size_t k) const
+    {
+        return static_cast<double>(field[(i * ny + j) * nz + k]);
+    }
+
+    int cube_index(const T *p, double iso) const
+    {
+        int index = 0;
+        for (int c = 0; c < 8; ++c)
+        {
+            index |= (p[corner_offset[c]] >= iso) << c;
+        }
+        return index;
+    }
+
+    // vertices of point layer i: the edges along x and y in the layer and
+    // those along z to the next layer, numbered in this order into
+    // ids[3 * (j * nz + k) + axis], -1 if not crossed; returns their number
+    int crossings(size_t i, double iso, int *ids) const
+    {
+        int n = 0;
+        const T *p = field + i * layer;
+        for (size_t j = 0; j < ny; ++j)
+        {
+            for (size_t k = 0; k < nz; ++k)
+            {
+                const size_t o = j * nz + k;
+                const bool above = p[o] >= iso;
+                const bool has[3] = {k + 1 < nz, j + 1 < ny, i + 1 < nx};
+                for (int a = 0; a < 3; ++a)
+                {
+                    const bool crossed =
+                        has[a] && (p[o + edge_step[a]] >= iso) != above;
+                    if (ids)
+                    {
+                        ids[3 * o + a] = crossed ? n : -1;
+                    }
+                    n += crossed;
+                }
+            }
+        }
+        return n;
+    }
+
+    void count_layers(int t, std::vector<size_t> &nvertices,
+                      std::vector<size_t> &ntriangles) const
+    {
+        size_t c0, c1;
+        layers(t, c0, c1);
+        const size_t p1 = (c1 == nx - 1) ? nx : c1;
+        for (size_t i = c0; i < p1; ++i)
+        {
+            for (size_t n = 0; n < niso; ++n)
+            {
+                const double iso = isovalues[n];
+                nvertices[n * nx + i] = crossings(i, iso, nullptr);
+                if (i + 1 == nx)
+                {
+                    continue;
+                }
+                size_t m = 0;
+                for (size_t j = 0; j + 1 < ny; ++j)
+                {
+                    const T *p = field + i * layer + j * nz;
+                    for (size_t k = 0; k + 1 < nz; ++k)
+                    {
+                        m += table[cube_index(p + k, iso)].ntriangles;
+                    }
+                }
+                ntriangles[n * nx + i] = m;
+            }
+        }
+    }
+
+    // gradient of the field at a point, one-sided at the sides of the block
+    void gradient(size_t i, size_t j, size_t k, double g[3]) const
+    {
+        const size_t idx[3] = {k, j, i};
+        const size_t dim[3] = {nz, ny, nx};
+        for (int a = 0; a < 3; ++a)
+        {
+            size_t lo[3] = {i, j, k}, hi[3] = {i, j, k};
+            double h = 2.0;
+            if (idx[a] == 0)
+            {
+                h = 1.0;
+            }
+            else
+            {
+                --lo[2 - a];
+            }
+            if (idx[a] + 1 == dim[a])
+            {
+                h -= 1.0;
+            }
+            else
+            {
+                ++hi[2 - a];
+            }
+            g[a] = h > 0.0 ? (value(hi[0], hi[1], hi[2]) -
+                              value(lo[0], lo[1], lo[2])) /
+                                 h
+                           : 0.0;
+        }
+    }
+
+    // vertex on the edge along axis a from point (i, j, k) into x and nrm
+    void add_vertex(size_t i, size_t j, size_t k, int a, double iso,
+                    double *x, double *nrm) const
+    {
+        const size_t p0 = (i * ny + j) * nz + k;
+        const double v0 = field[p0], v1 = field[p0 + edge_step[a]];
+        const double s = (iso - v0) / (v1 - v0);
+
+        x[0] = static_cast<double>(start[2] + k);
+        x[1] = static_cast<double>(start[1] + j);
+        x[2] = static_cast<double>(start[0] + i);
+        x[a] += s;
+
+        double g0[3], g1[3];
+        gradient(i, j, k, g0);
+        gradient(i + (a == 2), j + (a == 1), k + (a == 0), g1);
+        double len = 0.0;
+        for (int d = 0; d < 3; ++d)
+        {
+            nrm[d] = -(g0[d] + s * (g1[d] - g0[d]));
+            len += nrm[d] * nrm[d];
+        }
+        len = std::sqrt(len);
+        if (len > 0.0)
+        {
+            for (int d = 0; d < 3; ++d)
+            {
+                nrm[d] /= len;
+            }
+        }
+    }
+
+    // vertex ids of layer i, and its vertices if the thread owns the layer
+    void add_layer(size_t i, bool owned, std::vector<int> *ids,
+                   double *points, double *normals, const int *slot) const
+    {
+        for (size_t n = 0; n < niso; ++n)
+        {
+            const double iso = isovalues[n];
+            int *id = ids[n].data();
+            crossings(i, iso, id);
+            if (!owned)
+            {
+                continue;
+            }
+            const size_t base = vertex_offset[n * nx + i];
+            for (size_t j = 0; j < ny; ++j)
+            {
+                for (size_t k = 0; k < nz; ++k)
+                {
+                    const size_t o = j * nz + k;
+                    for (int a = 0; a < 3; ++a)
+                    {
+                        if (id[3 * o + a] < 0)
+                        {
+                            continue;
+                        }
+                        size_t v = base + id[3 * o + a];
+                        if (slot)
+                        {
+                            if (slot[v] < 0)
+                            {
+                                continue;
+                            }
+                            v = slot[v];
+                        }
+                        add_vertex(i, j, k, a, iso, points + 3 * v,
+                                   normals + 3 * v);
+                    }
+                }
+            }
+        }
+    }
+
+    void generate(int t, double *points, double *normals, int *cells,
+                  int point_offset, const int *slot,
+                  const int *point_ids) const
+    {
+        size_t c0, c1;
+        layers(t, c0, c1);
+        auto owned = [&](size_t i) { return i < c1 || i == nx - 1; };
+
+        // vertex ids of the edges of this and the next layer, per isovalue
+        std::vector<std::vector<int>> ids[2];
+        ids[0].assign(niso, std::vector<int>(3 * layer));
+        ids[1].assign(niso, std::vector<int>(3 * layer));
+
+        add_layer(c0, true, ids[0].data(), points, normals, slot);
+        for (size_t i = c0; i < c1; ++i)
+        {
+            add_layer(i + 1, owned(i + 1), ids[1].data(), points, normals,
+                      slot);
+            for (size_t n = 0; n < niso; ++n)
+            {
+                const double iso = isovalues[n];
+                const int base = static_cast<int>(vertex_offset[n * nx + i]);
+                const int next_base =
+                    static_cast<int>(vertex_offset[n * nx + i + 1]);
+                const int *lo = ids[0][n].data();
+                const int *hi = ids[1][n].data();
+                int *cell = cells + 3 * triangle_offset[n * nx + i];
+                for (size_t j = 0; j + 1 < ny; ++j)
+                {
+                    for (size_t k = 0; k + 1 < nz; ++k)
+                    {
+                        const size_t o = j * nz + k;
+                        const auto &cs =
+                            table[cube_index(field + i * layer + o, iso)];
+                        for (int m = 0; m < 3 * cs.ntriangles; ++m)
+                        {
+                            // the edge at its lower corner, in this layer
+                            // or the next one
+                            const int e = cs.edges[m];
+                            const size_t q = o + edge_origin[e];
+                            const int a = edge_axis[e];
+                            const int v =
+                                q < layer
+                                    ? base + lo[3 * q + a]
+                                    : next_base + hi[3 * (q - layer) + a];
+                            *cell++ =
+                                point_ids ? point_ids[v] : point_offset + v;
+                        }
+                    }
+                }
+            }
+            std::swap(ids[0], ids[1]);
+        }
+    }
+};
+
+/*
+ * Isosurfaces of array[count[0]][count[1]][count[2]] at start for all
+ * isovalues into mesh, see MarchingCubes
+ */
+template <class T>
+void marching_cubes(const std::vector<size_t> &start,
+                    const std::vector<size_t> &count, const T *field,
+                    const std::vector<double> &isovalues, Mesh &mesh,
+                    int nthreads = 1)
+{
+    MarchingCubes<T> mc(start, count, field, isovalues, nthreads);
+    mesh.points.resize(3 * mc.npoints());
+    mesh.normals.resize(3 * mc.npoints());
+    mesh.cells.resize(3 * mc.ncells());
+    mesh.first_point = mc.first_point();
+    mesh.first_cell = mc.first_cell();
+    mc.extract(mesh.points.data(), mesh.normals.data(), mesh.cells.data());
+}
+
+#endif
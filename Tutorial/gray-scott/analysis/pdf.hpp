@@ -0,0 +1,247 @@
+#ifndef __PDF_HPP__
+#define __PDF_HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <thread>
+#include <vector>
+
+/*
+ * PDFs of the 2D slices of a 3D array, used by pdf_calc and analysis_host
+ */
+
+inline bool epsilon(double d) { return (d < 1.0e-20); }
+inline bool epsilon(float d) { return (d < 1.0e-20); }
+
+/*
+ * Histogram of nslices consecutive slices of slice_size values each into
+ * hist[nslices][nbins] for values in [min, max]. Values out of the range are
+ * not binned but counted in outliers.
+ * The bin index is computed by multiplying with the reciprocal of the bin
+ * width in chunks that the compiler can vectorize, then the counters are
+ * incremented. Each thread works on a contiguous part of the data and counts
+ * into its own sub-histogram; these are added up at the end.
+ */
+template <class T, class C>
+void histogram_slices(const T *data, const size_t nslices,
+                      const size_t slice_size, const size_t nbins, const T min,
+                      const T max, C *hist, size_t &outliers, int nthreads)
+{
+    const size_t n = nslices * slice_size;
+    std::fill(hist, hist + nslices * nbins, C(0));
+    outliers = 0;
+    if (!n)
+    {
+        return;
+    }
+    if (nthreads < 1)
+    {
+        nthreads = 1;
+    }
+    if (static_cast<size_t>(nthreads) > n)
+    {
+        nthreads = static_cast<int>(n);
+    }
+
+    const T scale = static_cast<T>(nbins) / (max - min);
+    const T last = static_cast<T>(nbins - 1);
+    const int outside = static_cast<int>(nbins);
+
+    // sub-histogram of the slices touched by each thread, with nbins + 1
+    // counters per slice where the last one counts the outliers
+    std::vector<std::vector<C>> sub(nthreads);
+    std::vector<size_t> first_slice(nthreads, 0);
+
+    auto worker = [&](const int t) {
+        const size_t begin = n * t / nthreads;
+        const size_t end = n * (t + 1) / nthreads;
+        if (begin == end)
+        {
+            return;
+        }
+        const size_t s0 = begin / slice_size;
+        const size_t s1 = (end - 1) / slice_size;
+        first_slice[t] = s0;
+        std::vector<C> &h = sub[t];
+        h.assign((s1 - s0 + 1) * (nbins + 1), C(0));
+
+        const size_t chunk = 512;
+        int idx[chunk];
+        size_t i = begin;
+        while (i < end)
+        {
+            const size_t s = i / slice_size;
+            const size_t slice_end = std::min(end, (s + 1) * slice_size);
+            C *hs = h.data() + (s - s0) * (nbins + 1);
+            while (i < slice_end)
+            {
+                const size_t m = std::min(chunk, slice_end - i);
+                const T *p = data + i;
+                // branch-free bin index, clamped before the conversion
+                for (size_t k = 0; k < m; ++k)
+                {
+                    T x = (p[k] - min) * scale;
+                    x = (x >= T(0)) ? x : T(0);
+                    x = (x <= last) ? x : last;
+                    idx[k] = (p[k] >= min && p[k] <= max)
+                                 ? static_cast<int>(x)
+                                 : outside;
+                }
+                for (size_t k = 0; k < m; ++k)
+                {
+                    ++hs[idx[k]];
+                }
+                i += m;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nthreads; ++t)
+    {
+        threads.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto &th : threads)
+    {
+        th.join();
+    }
+
+    // merge the sub-histograms
+    for (int t = 0; t < nthreads; ++t)
+    {
+        const std::vector<C> &h = sub[t];
+        const size_t ns = h.size() / (nbins + 1);
+        for (size_t ls = 0; ls < ns; ++ls)
+        {
+            C *hs = hist + (first_slice[t] + ls) * nbins;
+            const C *src = h.data() + ls * (nbins + 1);
+            for (size_t b = 0; b < nbins; ++b)
+            {
+                hs[b] += src[b];
+            }
+            outliers += src[nbins];
+        }
+    }
+}
+
+/*
+ * Bin edges of nbins bins between min and max
+ */
+template <class T>
+void compute_bins(const size_t nbins, const T min, const T max,
+                  std::vector<T> &bins)
+{
+    bins.resize(nbins);
+    T binWidth = (max - min) / nbins;
+    for (auto i = 0; i < nbins; ++i)
+    {
+        bins[i] = min + (i * binWidth);
+    }
+}
+
+/*
+ * Function to compute the PDF of the 2D slices of a box
+ * Adds the counts of nslices slices of slice_size values each to
+ * pdf[nslices][nbins], returns the number of values out of [min, max]
+ */
+template <class T>
+size_t compute_pdf(const T *data, const size_t nslices,
+                   const size_t slice_size, const size_t nbins, const T min,
+                   const T max, uint64_t *pdf, int nthreads)
+{
+    T binWidth = (max - min) / nbins;
+
+    if (nbins == 1)
+    {
+        // special case: only one bin
+        for (auto i = 0; i < nslices; ++i)
+        {
+            pdf[i] += slice_size;
+        }
+        return 0;
+    }
+
+    if (epsilon(max - min) || epsilon(binWidth))
+    {
+        // special case: constant array
+        for (auto i = 0; i < nslices; ++i)
+        {
+            pdf[i * nbins + (nbins / 2)] += slice_size;
+        }
+        return 0;
+    }
+
+    // integer counters, 32 bits are enough unless a slice is huge
+    size_t outliers;
+    if (slice_size <= std::numeric_limits<uint32_t>::max())
+    {
+        std::vector<uint32_t> hist(nslices * nbins);
+        histogram_slices(data, nslices, slice_size, nbins, min, max,
+                         hist.data(), outliers, nthreads);
+        std::transform(hist.begin(), hist.end(), pdf, pdf,
+                       std::plus<uint64_t>());
+    }
+    else
+    {
+        std::vector<uint64_t> hist(nslices * nbins);
+        histogram_slices(data, nslices, slice_size, nbins, min, max,
+                         hist.data(), outliers, nthreads);
+        std::transform(hist.begin(), hist.end(), pdf, pdf,
+                       std::plus<uint64_t>());
+    }
+    return outliers;
+}
+
+/*
+ * Balanced 1D partitioning of n elements into nparts parts, the first
+ * n % nparts parts get one more element
+ */
+inline void partition(const size_t n, const int nparts, const int part,
+               size_t &start, size_t &count)
+{
+    const size_t p = static_cast<size_t>(part);
+    const size_t base = n / nparts;
+    const size_t rem = n % nparts;
+    count = base + (p < rem ? 1 : 0);
+    start = p * base + std::min(p, rem);
+}
+
+/*
+ * Min and max of two arrays in a single pass over both
+ * mm = {min(a), min(b), max(a), max(b)}, +/-max() for empty arrays
+ */
+template <class T>
+void minmax_fused(const std::vector<T> &a, const std::vector<T> &b, T mm[4])
+{
+    T amin = std::numeric_limits<T>::max();
+    T bmin = std::numeric_limits<T>::max();
+    T amax = std::numeric_limits<T>::lowest();
+    T bmax = std::numeric_limits<T>::lowest();
+    const size_t n = std::min(a.size(), b.size());
+    for (size_t i = 0; i < n; ++i)
+    {
+        amin = a[i] < amin ? a[i] : amin;
+        amax = a[i] > amax ? a[i] : amax;
+        bmin = b[i] < bmin ? b[i] : bmin;
+        bmax = b[i] > bmax ? b[i] : bmax;
+    }
+    for (size_t i = n; i < a.size(); ++i)
+    {
+        amin = a[i] < amin ? a[i] : amin;
+        amax = a[i] > amax ? a[i] : amax;
+    }
+    for (size_t i = n; i < b.size(); ++i)
+    {
+        bmin = b[i] < bmin ? b[i] : bmin;
+        bmax = b[i] > bmax ? b[i] : bmax;
+    }
+    mm[0] = amin;
+    mm[1] = bmin;
+    mm[2] = amax;
+    mm[3] = bmax;
+}
+
+#endif
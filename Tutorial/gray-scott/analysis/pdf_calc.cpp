@@ -11,87 +11,642 @@
 #include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "adios2.h"
 
-bool epsilon(double d) { return (d < 1.0e-20); }
-bool epsilon(float d) { return (d < 1.0e-20); }
+#include "../common/step_reader.hpp"
+#include "pdf.hpp"
+#include "tdigest.hpp"
 
 /*
- * Function to compute the PDF of a 2D slice
+ * Part of a global array read by this process
+ */
+struct ReadBox
+{
+    adios2::Dims start;
+    adios2::Dims count;
+    size_t block_id; // writer block, with --decomp=writer
+    std::vector<double> u;
+    std::vector<double> v;
+};
+
+/*
+ * Input of one step, read ahead of the computation by the StepReader
+ */
+struct InputStep
+{
+    adios2::Dims shape;
+    std::vector<ReadBox> boxes;
+    bool have_minmax = false; // global min/max from metadata
+    std::pair<double, double> minmax_u;
+    std::pair<double, double> minmax_v;
+    int sim_step = -5;
+};
+
+/*
+ * The box of this process in a slab (1D), pencil (2D) or block (3D)
+ * decomposition of a 3D array, or nothing if the process has no work
+ */
+std::vector<ReadBox> decompose(const adios2::Dims &shape,
+                               const std::string &decomp, const int rank,
+                               const int nproc)
+{
+    int dims[3] = {nproc, 1, 1};
+    if (decomp == "pencil")
+    {
+        int d2[2] = {0, 0};
+        MPI_Dims_create(nproc, 2, d2);
+        dims[0] = d2[0];
+        dims[1] = d2[1];
+    }
+    else if (decomp == "block")
+    {
+        dims[0] = dims[1] = dims[2] = 0;
+        MPI_Dims_create(nproc, 3, dims);
+    }
+    int coords[3] = {rank / (dims[1] * dims[2]), (rank / dims[2]) % dims[1],
+                     rank % dims[2]};
+
+    ReadBox box;
+    box.start.resize(3);
+    box.count.resize(3);
+    box.block_id = 0;
+    for (int d = 0; d < 3; ++d)
+    {
+        partition(shape[d], dims[d], coords[d], box.start[d], box.count[d]);
+        if (!box.count[d])
+        {
+            return {};
+        }
+    }
+    return {box};
+}
+
+/*
+ * Whole writer blocks assigned to this process, the largest blocks first
+ * to the least loaded process
+ */
+std::vector<ReadBox>
+assign_blocks(const std::vector<adios2::Variable<double>::Info> &blocks,
+              const int rank, const int nproc)
+{
+    std::vector<size_t> order(blocks.size());
+    std::vector<size_t> volume(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        order[i] = i;
+        volume[i] = blocks[i].Count[0] * blocks[i].Count[1] * blocks[i].Count[2];
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return volume[a] > volume[b];
+    });
+
+    std::vector<size_t> load(nproc, 0);
+    std::vector<ReadBox> boxes;
+    for (size_t i : order)
+    {
+        int p = static_cast<int>(std::min_element(load.begin(), load.end()) -
+                                 load.begin());
+        load[p] += volume[i];
+        if (p == rank)
+        {
+            ReadBox box;
+            box.start = blocks[i].Start;
+            box.count = blocks[i].Count;
+            box.block_id = blocks[i].BlockID;
+            boxes.push_back(std::move(box));
+        }
+    }
+    return boxes;
+}
+
+// z of the 95% confidence intervals of sampled PDFs
+const double sample_z = 1.96;
+
+/*
+ * Fraction of the values of a slice to sample: the given fraction, or enough
+ * values that the 95% confidence interval of the probability of any bin is
+ * at most +/- error wide (p(1-p) <= 1/4)
+ */
+double sample_fraction(const adios2::Dims &shape, double fraction,
+                       double error)
+{
+    if (error > 0.0)
+    {
+        const double n = sample_z * sample_z / (4.0 * error * error);
+        fraction = n / (shape[1] * shape[2]);
+    }
+    return std::min(1.0, fraction);
+}
+
+// stride of the rows in y to sample a fraction of the values
+size_t sample_stride(const double fraction)
+{
+    return std::max<long>(1, std::lround(1.0 / fraction));
+}
+
+/*
+ * Every stride-th row in y of the global array, starting at phase, in the
+ * boxes. Each row becomes a box of its own.
+ */
+std::vector<ReadBox> sample_rows(const std::vector<ReadBox> &boxes,
+                                 const size_t stride, const size_t phase)
+{
+    std::vector<ReadBox> rows;
+    for (const auto &box : boxes)
+    {
+        const size_t y0 = box.start[1];
+        const size_t y1 = y0 + box.count[1];
+        size_t y = y0 + (phase % stride + stride - y0 % stride) % stride;
+        for (; y < y1; y += stride)
+        {
+            ReadBox row;
+            row.start = box.start;
+            row.count = box.count;
+            row.start[1] = y;
+            row.count[1] = 1;
+            row.block_id = box.block_id;
+            rows.push_back(std::move(row));
+        }
+    }
+    return rows;
+}
+
+/*
+ * A random subset of the writer blocks with the given fraction of the
+ * blocks, the same on all processes for the same seed
+ */
+std::vector<adios2::Variable<double>::Info>
+sample_blocks(const std::vector<adios2::Variable<double>::Info> &blocks,
+              const double fraction, const unsigned seed)
+{
+    std::vector<size_t> order(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::mt19937 gen(seed);
+    std::shuffle(order.begin(), order.end(), gen);
+    size_t n = static_cast<size_t>(std::ceil(fraction * blocks.size()));
+    n = std::max<size_t>(1, std::min(n, blocks.size()));
+    order.resize(n);
+    std::sort(order.begin(), order.end());
+
+    std::vector<adios2::Variable<double>::Info> subset;
+    for (size_t i : order)
+    {
+        subset.push_back(blocks[i]);
+    }
+    return subset;
+}
+
+/*
+ * PDF of a slice of slice_size values from the counts of a sample of it,
+ * pdf[nbins] is scaled from the counts to the whole slice. The sample
+ * consists of clusters of correlated values (rows or parts of blocks):
+ * cc and cn are the sums of c*c and c*n of the clusters per bin, with c the
+ * count of the bin in a cluster and n the size of the cluster, nn the sum of
+ * n*n and m the number of clusters. lower/upper get 95% bounds from the
+ * variance between the clusters, at least the binomial variance (with the
+ * Agresti-Coull estimate, so empty bins are not certain either). Returns the
+ * number of sampled values; a slice without samples gets 0 in [0, slice_size].
+ */
+double estimate_pdf(double *pdf, const size_t nbins, const double slice_size,
+                    const double *cc, const double *cn, const double nn,
+                    const double m, double *lower, double *upper)
+{
+    double n = 0.0;
+    for (size_t b = 0; b < nbins; ++b)
+    {
+        n += pdf[b];
+    }
+    if (n == 0.0)
+    {
+        std::fill(lower, lower + nbins, 0.0);
+        std::fill(upper, upper + nbins, slice_size);
+        return n;
+    }
+
+    const double z2 = sample_z * sample_z;
+    const double fpc = std::max(0.0, 1.0 - n / slice_size);
+    for (size_t b = 0; b < nbins; ++b)
+    {
+        const double p = pdf[b] / n;
+        const double pt = (pdf[b] + z2 / 2) / (n + z2);
+        double var = pt * (1 - pt) / (n + z2);
+        if (m > 1)
+        {
+            // ratio estimator: sum over clusters of (c - p n)^2
+            const double ss = std::max(0.0, cc[b] - 2 * p * cn[b] + p * p * nn);
+            var = std::max(var, m / (m - 1) * ss / (n * n));
+        }
+        const double half = sample_z * std::sqrt(fpc * var);
+        lower[b] = std::max(0.0, p - half) * slice_size;
+        upper[b] = std::min(1.0, p + half) * slice_size;
+        pdf[b] = p * slice_size;
+    }
+    return n;
+}
+
+/*
+ * Global min/max of a variable in the current step from the metadata of
+ * the engine. Returns false if the engine does not provide it (e.g. HDF5).
  */
 template <class T>
-void compute_pdf(const std::vector<T> &data,
-                 const std::vector<std::size_t> &shape, const size_t start,
-                 const size_t count, const size_t nbins, const T min,
-                 const T max, std::vector<T> &pdf, std::vector<T> &bins)
+bool global_minmax(adios2::Variable<T> &var, const std::string &engine_type,
+                   std::pair<T, T> &minmax)
+{
+    if (engine_type == "HDF5")
+    {
+        return false;
+    }
+    try
+    {
+        minmax = var.MinMax();
+    }
+    catch (std::exception &e)
+    {
+        return false;
+    }
+    // no statistics were collected by the writer
+    return minmax.first < minmax.second;
+}
+
+/*
+ * Quantiles of U and V from t-digests, of each slice and of the whole
+ * variables, in the current step and over all steps so far.
+ * The digests of the slices are merged on the owners of the slices and the
+ * digests of the whole variables on process 0, all with one reduction.
+ */
+class QuantileSketches
 {
-    if (shape.size() != 3)
-        throw std::invalid_argument("ERROR: shape is expected to be 3D\n");
+public:
+    // quantiles of U [0] and V [1]: [own slices][probs] and [probs]
+    std::vector<double> slice[2];
+    std::vector<double> slice_running[2];
+    std::vector<double> global[2];
+    std::vector<double> global_running[2];
+
+    QuantileSketches(const std::vector<double> &probs, double compression,
+                     MPI_Comm comm)
+    : probs(probs), compression(compression), comm(comm),
+      psize(TDigest::packed_size(compression))
+    {
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &nproc);
+        type = tdigest_datatype(compression);
+        op = tdigest_op();
+        for (int i = 0; i < 2; ++i)
+        {
+            running_global[i] = TDigest(compression);
+        }
+    }
+
+    ~QuantileSketches()
+    {
+        MPI_Op_free(&op);
+        MPI_Type_free(&type);
+    }
 
-    size_t slice_size = shape[1] * shape[2];
-    pdf.resize(count * nbins);
-    bins.resize(nbins);
+    /*
+     * Sketch the slices of the boxes of this process and merge the sketches,
+     * the slices of process r are [own_displs[r], + own_counts[r])
+     */
+    void update(const std::vector<ReadBox> &boxes, const size_t nslices,
+                const std::vector<int> &own_counts,
+                const std::vector<int> &own_displs, int nthreads)
+    {
+        std::vector<TDigest> sk[2];
+        sketch_slices(boxes, nslices, nthreads, sk);
+
+        // per process: [U own slices][V own slices], on process 0 followed
+        // by U and V of the whole variables
+        std::vector<int> counts(nproc), displs(nproc);
+        int n = 0;
+        for (int r = 0; r < nproc; ++r)
+        {
+            counts[r] = 2 * own_counts[r] + (r == 0 ? 2 : 0);
+            displs[r] = n;
+            n += counts[r];
+        }
+        std::vector<double> send(static_cast<size_t>(n) * psize);
+        TDigest local[2] = {TDigest(compression), TDigest(compression)};
+        for (int r = 0; r < nproc; ++r)
+        {
+            for (int i = 0; i < own_counts[r]; ++i)
+            {
+                const size_t z = own_displs[r] + i;
+                for (int j = 0; j < 2; ++j)
+                {
+                    local[j].merge(sk[j][z]);
+                    sk[j][z].pack(
+                        &send[(displs[r] + j * own_counts[r] + i) * psize]);
+                }
+            }
+        }
+        for (int j = 0; j < 2; ++j)
+        {
+            local[j].pack(&send[(2 * own_counts[0] + j) * psize]);
+        }
+
+        std::vector<double> recv(counts[rank] * psize);
+        MPI_Reduce_scatter(send.data(), recv.data(), counts.data(), type, op,
+                           comm);
+
+        const size_t count1 = own_counts[rank];
+        const size_t nq = probs.size();
+        if (running_slice[0].size() != count1)
+        {
+            for (int j = 0; j < 2; ++j)
+            {
+                running_slice[j].assign(count1, TDigest(compression));
+            }
+        }
+        for (int j = 0; j < 2; ++j)
+        {
+            slice[j].resize(count1 * nq);
+            slice_running[j].resize(count1 * nq);
+            for (size_t i = 0; i < count1; ++i)
+            {
+                TDigest d = TDigest::unpack(&recv[(j * count1 + i) * psize]);
+                running_slice[j][i].merge(d);
+                quantiles(d, &slice[j][i * nq]);
+                quantiles(running_slice[j][i], &slice_running[j][i * nq]);
+            }
+        }
+
+        // the quantiles of the whole variables to every process
+        std::vector<double> g(4 * nq);
+        if (!rank)
+        {
+            for (int j = 0; j < 2; ++j)
+            {
+                TDigest d = TDigest::unpack(&recv[(2 * count1 + j) * psize]);
+                running_global[j].merge(d);
+                quantiles(d, &g[j * nq]);
+                quantiles(running_global[j], &g[(2 + j) * nq]);
+            }
+        }
+        MPI_Bcast(g.data(), static_cast<int>(g.size()), MPI_DOUBLE, 0, comm);
+        for (int j = 0; j < 2; ++j)
+        {
+            global[j].assign(g.begin() + j * nq, g.begin() + (j + 1) * nq);
+            global_running[j].assign(g.begin() + (2 + j) * nq,
+                                     g.begin() + (3 + j) * nq);
+        }
+    }
 
-    size_t start_data = 0;
-    size_t start_pdf = 0;
+private:
+    std::vector<double> probs;
+    double compression;
+    MPI_Comm comm;
+    int rank, nproc;
+    size_t psize; // doubles of a packed digest
+    MPI_Datatype type;
+    MPI_Op op;
+    std::vector<TDigest> running_slice[2]; // own slices, on the owners
+    TDigest running_global[2];             // on process 0
 
-    T binWidth = (max - min) / nbins;
-    for (auto i = 0; i < nbins; ++i)
+    void quantiles(TDigest &d, double *q)
     {
-        bins[i] = min + (i * binWidth);
+        for (size_t i = 0; i < probs.size(); ++i)
+        {
+            q[i] = d.quantile(probs[i]);
+        }
     }
 
-    if (nbins == 1)
+    // digests of U and V of all slices, each thread sketches a range of
+    // slices in all boxes
+    void sketch_slices(const std::vector<ReadBox> &boxes, const size_t nslices,
+                       int nthreads, std::vector<TDigest> sk[2])
     {
-        // special case: only one bin
-        for (auto i = 0; i < count; ++i)
+        for (int j = 0; j < 2; ++j)
         {
-            pdf[i] = slice_size;
+            sk[j].assign(nslices, TDigest(compression));
         }
-        return;
+        nthreads = static_cast<int>(
+            std::max<size_t>(1, std::min<size_t>(nthreads, nslices)));
+        auto worker = [&](const int t) {
+            const size_t z0 = nslices * t / nthreads;
+            const size_t z1 = nslices * (t + 1) / nthreads;
+            for (const auto &box : boxes)
+            {
+                const size_t slice_size = box.count[1] * box.count[2];
+                const size_t b0 = std::max(z0, box.start[0]);
+                const size_t b1 = std::min(z1, box.start[0] + box.count[0]);
+                for (size_t z = b0; z < b1; ++z)
+                {
+                    const size_t offset = (z - box.start[0]) * slice_size;
+                    sk[0][z].add(box.u.data() + offset, slice_size);
+                    sk[1][z].add(box.v.data() + offset, slice_size);
+                }
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int t = 1; t < nthreads; ++t)
+        {
+            threads.emplace_back(worker, t);
+        }
+        worker(0);
+        for (auto &th : threads)
+        {
+            th.join();
+        }
+    }
+};
+
+/*
+ * Statistics of U and V over the steps, in constant memory: the PDFs of
+ * the slices with fixed bins, and the mean and variance of each voxel of
+ * the boxes of this process (Welford's algorithm). Values out of the fixed
+ * range are counted as underflow/overflow.
+ */
+class TimeAccumulator
+{
+public:
+    // results of emit(): U [0] and V [1]
+    std::vector<double> pdf[2];       // [own slices][nbins]
+    std::vector<double> bins[2];      // [nbins]
+    uint64_t outliers[2][2];          // {underflow, overflow}, all processes
+    std::vector<double> mean[2];      // per box, concatenated
+    std::vector<double> variance[2];  // sample variance, as mean
+    std::vector<adios2::Box<adios2::Dims>> boxes; // of mean and variance
+
+    TimeAccumulator(size_t nbins, MPI_Comm comm) : nbins(nbins), comm(comm)
+    {
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &nproc);
     }
 
-    if (epsilon(max - min) || epsilon(binWidth))
+    // bins between lo and hi for U [0] and V [1]
+    void set_range(const double lo[2], const double hi[2])
     {
-        // special case: constant array
-        for (auto i = 0; i < count; ++i)
+        for (int j = 0; j < 2; ++j)
         {
-            pdf[i * nbins + (nbins / 2)] = slice_size;
+            range[j][0] = lo[j];
+            range[j][1] = hi[j];
+            if (!(hi[j] > lo[j]))
+            {
+                // a constant first step
+                range[j][0] -= 0.5;
+                range[j][1] += 0.5;
+            }
         }
-        return;
+        has_range = true;
     }
+    bool range_set() const { return has_range; }
+
+    int steps() const { return nsteps; }
 
-    for (auto i = 0; i < count; ++i)
+    // add a step, the boxes must be the same in all steps
+    void add(const std::vector<ReadBox> &boxes, const size_t nslices,
+             int nthreads)
     {
-        // Calculate a PDF for 'nbins' bins for values between 'min' and 'max'
-        // from data[ start_data .. start_data+slice_size-1 ]
-        // into pdf[ start_pdf .. start_pdf+nbins-1 ]
-        for (auto j = 0; j < slice_size; ++j)
+        if (!nsteps)
         {
-            if (data[start_data + j] > max || data[start_data + j] < min)
+            this->boxes.clear();
+            for (const auto &box : boxes)
             {
-                std::cout << " data[" << start * slice_size + start_data + j
-                          << "] = " << data[start_data + j]
-                          << " is out of [min,max] = [" << min << "," << max
-                          << "]" << std::endl;
+                this->boxes.emplace_back(box.start, box.count);
             }
-            size_t bin = static_cast<size_t>(
-                std::floor((data[start_data + j] - min) / binWidth));
-            if (bin == nbins)
+            for (int j = 0; j < 2; ++j)
             {
-                bin = nbins - 1;
+                counts[j].assign(nslices * nbins, 0);
+                m1[j].clear();
+                m2[j].clear();
+                for (const auto &box : boxes)
+                {
+                    m1[j].insert(m1[j].end(), box.u.size(), 0.0);
+                }
+                m2[j] = m1[j];
+                local_outliers[j][0] = local_outliers[j][1] = 0;
             }
-            ++pdf[start_pdf + bin];
         }
-        start_pdf += nbins;
-        start_data += slice_size;
+        ++nsteps;
+
+        size_t offset = 0;
+        for (const auto &box : boxes)
+        {
+            const std::vector<double> *data[2] = {&box.u, &box.v};
+            const size_t slice_size = box.count[1] * box.count[2];
+            for (int j = 0; j < 2; ++j)
+            {
+                const double *x = data[j]->data();
+                const size_t n = data[j]->size();
+                size_t out = compute_pdf(x, box.count[0], slice_size, nbins,
+                                         range[j][0], range[j][1],
+                                         &counts[j][box.start[0] * nbins],
+                                         nthreads);
+                size_t under = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    under += (x[i] < range[j][0]);
+                }
+                local_outliers[j][0] += under;
+                local_outliers[j][1] += out - under;
+
+                // Welford update of mean and sum of squared differences
+                double *mj = m1[j].data() + offset;
+                double *sj = m2[j].data() + offset;
+                const double rn = 1.0 / nsteps;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const double delta = x[i] - mj[i];
+                    mj[i] += delta * rn;
+                    sj[i] += delta * (x[i] - mj[i]);
+                }
+            }
+            offset += box.u.size();
+        }
     }
-    return;
+
+    /*
+     * Sum the PDFs onto the owners of the slices, the slices of process r
+     * are [own_displs[r], + own_counts[r]), and compute the results
+     */
+    void emit(const std::vector<int> &own_counts,
+              const std::vector<int> &own_displs)
+    {
+        // per process: [U own slices][V own slices], as the PDFs of a step
+        std::vector<uint64_t> send(2 * counts[0].size());
+        std::vector<int> recvcounts(nproc);
+        size_t pos = 0;
+        for (int r = 0; r < nproc; ++r)
+        {
+            const size_t n = own_counts[r] * nbins;
+            for (int j = 0; j < 2; ++j)
+            {
+                std::copy(counts[j].begin() + own_displs[r] * nbins,
+                          counts[j].begin() + own_displs[r] * nbins + n,
+                          send.begin() + pos);
+                pos += n;
+            }
+            recvcounts[r] = static_cast<int>(2 * n);
+        }
+        std::vector<uint64_t> own(recvcounts[rank]);
+        MPI_Reduce_scatter(send.data(), own.data(), recvcounts.data(),
+                           MPI_UINT64_T, MPI_SUM, comm);
+        const size_t n = own.size() / 2;
+        for (int j = 0; j < 2; ++j)
+        {
+            pdf[j].assign(own.begin() + j * n, own.begin() + (j + 1) * n);
+            compute_bins(nbins, range[j][0], range[j][1], bins[j]);
+        }
+        MPI_Allreduce(local_outliers, outliers, 4, MPI_UINT64_T, MPI_SUM,
+                      comm);
+
+        for (int j = 0; j < 2; ++j)
+        {
+            mean[j] = m1[j];
+            variance[j].resize(m2[j].size());
+            const double rn = nsteps > 1 ? 1.0 / (nsteps - 1) : 0.0;
+            for (size_t i = 0; i < m2[j].size(); ++i)
+            {
+                variance[j][i] = m2[j][i] * rn;
+            }
+        }
+    }
+
+private:
+    size_t nbins;
+    MPI_Comm comm;
+    int rank, nproc;
+    bool has_range = false;
+    double range[2][2];
+    int nsteps = 0;
+    std::vector<uint64_t> counts[2]; // [slices][nbins] partial counts
+    uint64_t local_outliers[2][2];
+    std::vector<double> m1[2]; // running mean per voxel
+    std::vector<double> m2[2]; // running sum of squared differences
+};
+
+/*
+ * Comma separated list of numbers
+ */
+std::vector<double> parse_list(const std::string &s)
+{
+    std::vector<double> values;
+    size_t pos = 0;
+    while (pos < s.size())
+    {
+        size_t end = s.find(',', pos);
+        if (end == std::string::npos)
+        {
+            end = s.size();
+        }
+        values.push_back(std::stod(s.substr(pos, end - pos)));
+        pos = end + 1;
+    }
+    return values;
 }
 
 /*
@@ -100,12 +655,60 @@ void compute_pdf(const std::vector<T> &data,
 void printUsage()
 {
     std::cout
-        << "Usage: pdf_calc input output [N] [output_inputdata]\n"
+        << "Usage: pdf_calc input output [N] [output_inputdata] [options]\n"
         << "  input:   Name of the input file handle for reading data\n"
         << "  output:  Name of the output file to which data must be written\n"
         << "  N:       Number of bins for the PDF calculation, default = 1000\n"
         << "  output_inputdata: YES will write the original variables besides "
-           "the analysis results\n\n";
+           "the analysis results\n"
+        << "  options:\n"
+        << "    --threads=T  Number of threads per process computing the "
+           "PDFs, default = 1\n"
+        << "    --bins=global|local  Bins from the global min/max of a "
+           "variable, or\n"
+        << "                 from the min/max of the data of each process, "
+           "default = global\n"
+        << "    --decomp=slab|pencil|block|writer  Read slabs, pencils or "
+           "blocks of a\n"
+        << "                 balanced decomposition, or whole blocks of the "
+           "writers,\n"
+        << "                 default = slab\n"
+        << "    --prefetch=P  Number of steps read ahead in the background, "
+           "0 = read\n"
+        << "                 each step when it is processed, default = 1\n"
+        << "    --wait=I[:M[:F[:G]]]  BeginStep timeout starts at I seconds "
+           "and grows\n"
+        << "                 by F up to M while the next step is not ready, "
+           "give up\n"
+        << "                 after G seconds, default = 0.1:10:2:-1 (never)\n"
+        << "    --quantiles=P,P,...  Also write these quantiles (0..1) of each "
+           "slice\n"
+        << "                 and of the whole variables, per step and over "
+           "all steps,\n"
+        << "                 from t-digest sketches, default = none\n"
+        << "    --compression=C  Compression of the t-digests, more is more "
+           "accurate,\n"
+        << "                 default = 100\n"
+        << "    --accumulate=M  Also write statistics over all steps so far "
+           "every M\n"
+        << "                 steps and at the end (0 = only at the end): "
+           "PDFs with\n"
+        << "                 fixed bins and the mean and variance of each "
+           "voxel\n"
+        << "    --range=MIN:MAX[:VMIN:VMAX]  Fixed bins of the accumulated "
+           "PDFs of U\n"
+        << "                 (and V), default = min/max of the first step\n"
+        << "    --sample=F   Approximate PDFs from a fraction F (0..1] of the "
+           "values,\n"
+        << "                 scaled to the whole slices, with 95% confidence "
+           "bounds\n"
+        << "    --sample-error=E  Sample enough values for bounds of at most "
+           "+/-E of\n"
+        << "                 the probability of a bin, instead of --sample\n"
+        << "    --sample-by=rows|blocks  Sample every k-th row in y, or a "
+           "random subset\n"
+        << "                 of the writer blocks in each step, default = "
+           "rows\n\n";
 }
 
 /*
@@ -113,7 +716,9 @@ void printUsage()
  */
 int main(int argc, char *argv[])
 {
-    MPI_Init(&argc, &argv);
+    // steps are read ahead in a background thread
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
     int rank, comm_size, wrank;
 
     MPI_Comm_rank(MPI_COMM_WORLD, &wrank);
@@ -125,7 +730,135 @@ int main(int argc, char *argv[])
     MPI_Comm_rank(comm, &rank);
     MPI_Comm_size(comm, &comm_size);
 
-    if (argc < 3)
+    // --options can be anywhere, the rest are positional arguments
+    std::vector<std::string> args;
+    int nthreads = 1;
+    bool global_bins = true;
+    std::string decomp = "slab";
+    int prefetch = 1;
+    WaitPolicy wait_policy;
+    std::vector<double> probs;
+    double compression = 100.0;
+    int accumulate = -1;
+    std::vector<double> range;
+    double sample = 0.0;
+    double sample_error = 0.0;
+    std::string sample_by = "rows";
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg.compare(0, 10, "--threads=") == 0)
+        {
+            nthreads = std::max(1, std::stoi(arg.substr(10)));
+        }
+        else if (arg == "--bins=global" || arg == "--bins=local")
+        {
+            global_bins = (arg == "--bins=global");
+        }
+        else if (arg == "--decomp=slab" || arg == "--decomp=pencil" ||
+                 arg == "--decomp=block" || arg == "--decomp=writer")
+        {
+            decomp = arg.substr(9);
+        }
+        else if (arg.compare(0, 11, "--prefetch=") == 0)
+        {
+            prefetch = std::max(0, std::stoi(arg.substr(11)));
+        }
+        else if (parse_wait_option(arg, wait_policy) ||
+                 parse_latest_option(arg, wait_policy))
+        {
+            // wait_policy is set
+        }
+        else if (arg.compare(0, 12, "--quantiles=") == 0)
+        {
+            probs = parse_list(arg.substr(12));
+            for (double p : probs)
+            {
+                if (p < 0.0 || p > 1.0)
+                {
+                    throw std::invalid_argument(
+                        "ERROR: quantiles must be between 0 and 1\n");
+                }
+            }
+        }
+        else if (arg.compare(0, 13, "--accumulate=") == 0)
+        {
+            accumulate = std::max(0, std::stoi(arg.substr(13)));
+        }
+        else if (arg.compare(0, 8, "--range=") == 0)
+        {
+            std::string value = arg.substr(8);
+            std::replace(value.begin(), value.end(), ':', ',');
+            range = parse_list(value);
+            if (range.size() == 2)
+            {
+                range.push_back(range[0]);
+                range.push_back(range[1]);
+            }
+            if (range.size() != 4 || !(range[1] > range[0]) ||
+                !(range[3] > range[2]))
+            {
+                throw std::invalid_argument(
+                    "ERROR: --range needs MIN:MAX or MIN:MAX:VMIN:VMAX with "
+                    "MIN < MAX\n");
+            }
+        }
+        else if (arg.compare(0, 9, "--sample=") == 0)
+        {
+            sample = std::stod(arg.substr(9));
+            if (!(sample > 0.0 && sample <= 1.0))
+            {
+                throw std::invalid_argument(
+                    "ERROR: --sample needs a fraction in (0, 1]\n");
+            }
+        }
+        else if (arg.compare(0, 15, "--sample-error=") == 0)
+        {
+            sample_error = std::stod(arg.substr(15));
+            if (!(sample_error > 0.0 && sample_error < 1.0))
+            {
+                throw std::invalid_argument(
+                    "ERROR: --sample-error needs an error in (0, 1)\n");
+            }
+        }
+        else if (arg == "--sample-by=rows" || arg == "--sample-by=blocks")
+        {
+            sample_by = arg.substr(12);
+        }
+        else if (arg.compare(0, 14, "--compression=") == 0)
+        {
+            compression = std::stod(arg.substr(14));
+            if (compression < 10.0)
+            {
+                throw std::invalid_argument(
+                    "ERROR: compression must be at least 10\n");
+            }
+        }
+        else if (arg.compare(0, 2, "--") == 0)
+        {
+            if (rank == 0)
+            {
+                std::cout << "Unknown option " << arg << "\n";
+                printUsage();
+            }
+            MPI_Finalize();
+            return 0;
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    const bool sampling = sample > 0.0 || sample_error > 0.0;
+    if (sampling && accumulate >= 0)
+    {
+        // the statistics per voxel need all voxels in every step
+        throw std::invalid_argument(
+            "ERROR: --accumulate cannot be combined with sampling\n");
+    }
+
+    if (args.size() < 2)
     {
         std::cout << "Not enough arguments\n";
         if (rank == 0)
@@ -138,47 +871,43 @@ int main(int argc, char *argv[])
     std::string out_filename;
     size_t nbins = 1000;
     bool write_inputvars = false;
-    in_filename = argv[1];
-    out_filename = argv[2];
+    in_filename = args[0];
+    out_filename = args[1];
 
-    if (argc >= 4)
+    if (args.size() >= 3)
     {
-        int value = std::stoi(argv[3]);
+        int value = std::stoi(args[2]);
         if (value > 0)
             nbins = static_cast<size_t>(value);
     }
 
-    if (argc >= 5)
+    if (args.size() >= 4)
     {
-        std::string value = argv[4];
+        std::string value = args[3];
         std::transform(value.begin(), value.end(), value.begin(), ::tolower);
         if (value == "yes")
             write_inputvars = true;
     }
 
-    std::size_t u_global_size, v_global_size;
-    std::size_t u_local_size, v_local_size;
-
     bool firstStep = true;
 
     std::vector<std::size_t> shape;
 
-    std::vector<double> u;
-    std::vector<double> v;
     int simStep = -5;
 
-    std::vector<double> pdf_u;
-    std::vector<double> pdf_v;
-    std::vector<double> bins_u;
-    std::vector<double> bins_v;
-
     // adios2 variable declarations
-    adios2::Variable<double> var_u_in, var_v_in;
-    adios2::Variable<int> var_step_in;
     adios2::Variable<double> var_u_pdf, var_v_pdf;
     adios2::Variable<double> var_u_bins, var_v_bins;
     adios2::Variable<int> var_step_out;
     adios2::Variable<double> var_u_out, var_v_out;
+    adios2::Variable<double> var_probs;
+    adios2::Variable<double> var_q_slice[2], var_q_slice_running[2];
+    adios2::Variable<double> var_q_global[2], var_q_global_running[2];
+    adios2::Variable<double> var_acc_pdf[2], var_acc_bins[2];
+    adios2::Variable<uint64_t> var_acc_outliers[2];
+    adios2::Variable<double> var_mean[2], var_variance[2];
+    adios2::Variable<int> var_acc_steps;
+    adios2::Variable<double> var_lower[2], var_upper[2], var_samples;
 
     {
         // adios2 io object and engine init
@@ -195,75 +924,233 @@ int main(int argc, char *argv[])
             std::cout
                 << "PDF analysis writes using engine type:                 "
                 << writer_io.EngineType() << std::endl;
+            std::cout
+                << "PDF analysis computes with threads per process:        "
+                << nthreads << std::endl;
+            std::cout
+                << "PDF analysis bins are computed from min/max:           "
+                << (global_bins ? "global" : "local") << std::endl;
+            std::cout
+                << "PDF analysis reads with decomposition:                 "
+                << decomp << std::endl;
+            std::cout
+                << "PDF analysis quantiles from t-digests:                 ";
+            for (size_t i = 0; i < probs.size(); ++i)
+            {
+                std::cout << (i ? "," : "") << probs[i];
+            }
+            std::cout << (probs.empty() ? "none" : "") << std::endl;
+            std::cout
+                << "PDF analysis accumulates over steps, output every:     ";
+            if (accumulate < 0)
+                std::cout << "no" << std::endl;
+            else if (accumulate == 0)
+                std::cout << "end" << std::endl;
+            else
+                std::cout << accumulate << " steps" << std::endl;
+            std::cout
+                << "PDF analysis samples:                                  ";
+            if (!sampling)
+                std::cout << "no" << std::endl;
+            else if (sample_error > 0.0)
+                std::cout << sample_by << ", error " << sample_error
+                          << std::endl;
+            else
+                std::cout << sample_by << ", fraction " << sample
+                          << std::endl;
         }
 
-        // Engines for reading and writing
-        adios2::Engine reader =
-            reader_io.Open(in_filename, adios2::Mode::Read, comm);
-        adios2::Engine writer =
-            writer_io.Open(out_filename, adios2::Mode::Write, comm);
-
         bool shouldIWrite = (!rank || reader_io.EngineType() == "HDF5");
+        const std::string engine_type = reader_io.EngineType();
 
-        // read data per timestep
-        int stepAnalysis = 0;
-        while (true)
-        {
+        // Inquire the variables, select the boxes of this process and issue
+        // the Gets, for a step read ahead of the computation
+        auto read_input = [&](adios2::IO &io, adios2::Engine &reader,
+                              InputStep &in) {
+            adios2::Variable<double> var_u_in =
+                io.InquireVariable<double>("U");
+            adios2::Variable<double> var_v_in =
+                io.InquireVariable<double>("V");
+            adios2::Variable<int> var_step_in = io.InquireVariable<int>("step");
+
+            // global min/max from metadata, if the engine has it
+            in.have_minmax =
+                global_bins &&
+                global_minmax(var_u_in, engine_type, in.minmax_u) &&
+                global_minmax(var_v_in, engine_type, in.minmax_v);
+
+            in.shape = var_u_in.Shape();
 
-            // Begin step
-            adios2::StepStatus read_status =
-                reader.BeginStep(adios2::StepMode::Read, 10.0f);
-            if (read_status == adios2::StepStatus::NotReady)
+            // Boxes to read: whole writer blocks or a part of the global
+            // array in a slab, pencil or block decomposition, or a sample of
+            // them in a different sample in each step
+            std::vector<ReadBox> sel;
+            bool whole_blocks = false;
+            const size_t step = reader.CurrentStep();
+            const double fraction =
+                sampling ? sample_fraction(in.shape, sample, sample_error)
+                         : 1.0;
+            if (decomp == "writer" || (sampling && sample_by == "blocks"))
             {
-                // std::cout << "Stream not ready yet. Waiting...\n";
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                continue;
+                auto blocks = reader.BlocksInfo(var_u_in, step);
+                if (!blocks.empty())
+                {
+                    if (sampling && sample_by == "blocks")
+                    {
+                        blocks = sample_blocks(blocks, fraction,
+                                               static_cast<unsigned>(step));
+                    }
+                    sel = assign_blocks(blocks, rank, comm_size);
+                    whole_blocks = true;
+                }
+                else
+                {
+                    // engine without block metadata
+                    sel = decompose(in.shape, "slab", rank, comm_size);
+                }
             }
-            else if (read_status != adios2::StepStatus::OK)
+            else
             {
-                break;
+                sel = decompose(in.shape, decomp, rank, comm_size);
+            }
+            if (sampling && !(sample_by == "blocks" && whole_blocks))
+            {
+                const size_t stride = sample_stride(fraction);
+                sel = sample_rows(sel, stride, step % stride);
+                whole_blocks = false;
             }
 
-            int stepSimOut = reader.CurrentStep();
+            // the buffers of the boxes of an earlier step are reused
+            in.boxes.resize(sel.size());
+            for (size_t i = 0; i < sel.size(); ++i)
+            {
+                ReadBox &box = in.boxes[i];
+                box.start = sel[i].start;
+                box.count = sel[i].count;
+                box.block_id = sel[i].block_id;
+                if (whole_blocks)
+                {
+                    var_u_in.SetBlockSelection(box.block_id);
+                    var_v_in.SetBlockSelection(box.block_id);
+                }
+                else
+                {
+                    adios2::Box<adios2::Dims> box_sel(box.start, box.count);
+                    var_u_in.SetSelection(box_sel);
+                    var_v_in.SetSelection(box_sel);
+                }
+                reader.Get<double>(var_u_in, box.u);
+                reader.Get<double>(var_v_in, box.v);
+            }
+            if (shouldIWrite)
+            {
+                reader.Get<int>(var_step_in, &in.sim_step);
+            }
+        };
 
-            // Inquire variable and set the selection at the first step only
-            // This assumes that the variable dimensions do not change across
-            // timesteps
+        std::unique_ptr<QuantileSketches> sketches;
+        if (!probs.empty())
+        {
+            sketches.reset(new QuantileSketches(probs, compression, comm));
+        }
 
-            // Inquire variable
-            var_u_in = reader_io.InquireVariable<double>("U");
-            var_v_in = reader_io.InquireVariable<double>("V");
-            var_step_in = reader_io.InquireVariable<int>("step");
+        std::unique_ptr<TimeAccumulator> accum;
+        if (accumulate >= 0)
+        {
+            accum.reset(new TimeAccumulator(nbins, comm));
+            if (!range.empty())
+            {
+                double lo[2] = {range[0], range[2]};
+                double hi[2] = {range[1], range[3]};
+                accum->set_range(lo, hi);
+            }
+        }
+        int emitted_steps = 0;
 
-            std::pair<double, double> minmax_u = var_u_in.MinMax();
-            std::pair<double, double> minmax_v = var_v_in.MinMax();
+        // each process reads the slices it owns, unless sampling blocks
+        const bool own_slab =
+            decomp == "slab" && !(sampling && sample_by == "blocks");
 
-            shape = var_u_in.Shape();
+        // Engines for reading and writing, the selections stay the same
+        // for all steps unless sampling
+        StepReader<InputStep> reader(reader_io, in_filename, comm, read_input,
+                                     prefetch, !sampling, wait_policy);
+        adios2::Engine writer =
+            writer_io.Open(out_filename, adios2::Mode::Write, comm);
 
-            // Calculate global and local sizes of U and V
-            u_global_size = shape[0] * shape[1] * shape[2];
-            u_local_size = u_global_size / comm_size;
-            v_global_size = shape[0] * shape[1] * shape[2];
-            v_local_size = v_global_size / comm_size;
+        if (!rank)
+        {
+            std::cout
+                << "PDF analysis reads ahead steps:                        "
+                << reader.prefetch_depth() << std::endl;
+        }
 
-            size_t count1 = shape[0] / comm_size;
-            size_t start1 = count1 * rank;
-            if (rank == comm_size - 1)
+        // Statistics over the steps so far, in the current writer step
+        std::vector<int> own_counts, own_displs;
+        auto put_accumulated = [&]() {
+            const size_t count1 = own_counts[rank];
+            for (int j = 0; j < 2; ++j)
+            {
+                if (count1)
+                {
+                    writer.Put<double>(var_acc_pdf[j], accum->pdf[j].data());
+                }
+                if (shouldIWrite)
+                {
+                    writer.Put<double>(var_acc_bins[j], accum->bins[j].data());
+                    writer.Put<uint64_t>(var_acc_outliers[j],
+                                         accum->outliers[j]);
+                }
+                size_t offset = 0;
+                for (const auto &box : accum->boxes)
+                {
+                    var_mean[j].SetSelection(box);
+                    var_variance[j].SetSelection(box);
+                    writer.Put<double>(var_mean[j],
+                                       accum->mean[j].data() + offset);
+                    writer.Put<double>(var_variance[j],
+                                       accum->variance[j].data() + offset);
+                    offset += box.second[0] * box.second[1] * box.second[2];
+                }
+            }
+            if (shouldIWrite)
             {
-                // last process need to read all the rest of slices
-                count1 = shape[0] - count1 * (comm_size - 1);
+                writer.Put<int>(var_acc_steps, accum->steps());
             }
+            emitted_steps = accum->steps();
+        };
 
-            /*std::cout << "  rank " << rank << " slice start={" <<  start1
-              << ",0,0} count={" << count1  << "," << shape[1] << "," <<
-              shape[2]
-              << "}" << std::endl;*/
+        // read data per timestep
+        int stepAnalysis = 0;
+        while (true)
+        {
+            InputStep *in = reader.next();
+            if (!in)
+            {
+                break;
+            }
 
-            // Set selection
-            var_u_in.SetSelection(adios2::Box<adios2::Dims>(
-                {start1, 0, 0}, {count1, shape[1], shape[2]}));
-            var_v_in.SetSelection(adios2::Box<adios2::Dims>(
-                {start1, 0, 0}, {count1, shape[1], shape[2]}));
+            int stepSimOut = static_cast<int>(reader.current_step());
+            const std::vector<ReadBox> &boxes = in->boxes;
+            std::pair<double, double> minmax_u = in->minmax_u;
+            std::pair<double, double> minmax_v = in->minmax_v;
+            bool have_minmax = in->have_minmax;
+            shape = in->shape;
+            simStep = in->sim_step;
+
+            // The PDFs of the slices are owned by the processes in a
+            // balanced slab decomposition
+            own_counts.resize(comm_size);
+            own_displs.resize(comm_size);
+            for (int r = 0; r < comm_size; ++r)
+            {
+                size_t start, count;
+                partition(shape[0], comm_size, r, start, count);
+                own_displs[r] = static_cast<int>(start);
+                own_counts[r] = static_cast<int>(count);
+            }
+            size_t start1 = own_displs[rank];
+            size_t count1 = own_counts[rank];
 
             // Declare variables to output
             if (firstStep)
@@ -282,78 +1169,450 @@ int main(int argc, char *argv[])
                     var_step_out = writer_io.DefineVariable<int>("step");
                 }
 
+                if (sketches)
+                {
+                    const size_t nq = probs.size();
+                    const char *names[2] = {"U", "V"};
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        const std::string q = std::string(names[j]) +
+                                              "/quantiles";
+                        var_q_slice[j] = writer_io.DefineVariable<double>(
+                            q, {shape[0], nq}, {start1, 0}, {count1, nq});
+                        var_q_slice_running[j] =
+                            writer_io.DefineVariable<double>(
+                                q + "/running", {shape[0], nq}, {start1, 0},
+                                {count1, nq});
+                        if (shouldIWrite)
+                        {
+                            var_q_global[j] = writer_io.DefineVariable<double>(
+                                q + "/global", {nq}, {0}, {nq});
+                            var_q_global_running[j] =
+                                writer_io.DefineVariable<double>(
+                                    q + "/global/running", {nq}, {0}, {nq});
+                        }
+                    }
+                    if (shouldIWrite)
+                    {
+                        var_probs = writer_io.DefineVariable<double>(
+                            "quantiles", {nq}, {0}, {nq});
+                    }
+                }
+
+                if (accum)
+                {
+                    const char *names[2] = {"U", "V"};
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        const std::string name = names[j];
+                        const std::string a = name + "/accumulated";
+                        var_acc_pdf[j] = writer_io.DefineVariable<double>(
+                            a + "/pdf", {shape[0], nbins}, {start1, 0},
+                            {count1, nbins});
+                        var_mean[j] = writer_io.DefineVariable<double>(
+                            name + "/mean", {shape[0], shape[1], shape[2]});
+                        var_variance[j] = writer_io.DefineVariable<double>(
+                            name + "/variance",
+                            {shape[0], shape[1], shape[2]});
+                        if (shouldIWrite)
+                        {
+                            var_acc_bins[j] = writer_io.DefineVariable<double>(
+                                a + "/bins", {nbins}, {0}, {nbins});
+                            var_acc_outliers[j] =
+                                writer_io.DefineVariable<uint64_t>(
+                                    a + "/outliers", {2}, {0}, {2});
+                        }
+                    }
+                    if (shouldIWrite)
+                    {
+                        var_acc_steps =
+                            writer_io.DefineVariable<int>("accumulated/steps");
+                    }
+                }
+
+                if (sampling)
+                {
+                    // the PDFs are estimates from a sample
+                    const char *names[2] = {"U", "V"};
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        const std::string pdf = std::string(names[j]) + "/pdf";
+                        var_lower[j] = writer_io.DefineVariable<double>(
+                            pdf + "/lower", {shape[0], nbins}, {start1, 0},
+                            {count1, nbins});
+                        var_upper[j] = writer_io.DefineVariable<double>(
+                            pdf + "/upper", {shape[0], nbins}, {start1, 0},
+                            {count1, nbins});
+                        writer_io.DefineAttribute<std::string>(
+                            "approximate", "yes", pdf);
+                    }
+                    var_samples = writer_io.DefineVariable<double>(
+                        "pdf/samples", {shape[0]}, {start1}, {count1});
+                    const double fraction =
+                        sample_fraction(shape, sample, sample_error);
+                    writer_io.DefineAttribute<std::string>("sampling",
+                                                           sample_by);
+                    writer_io.DefineAttribute<double>(
+                        "sampling/fraction",
+                        sample_by == "rows" ? 1.0 / sample_stride(fraction)
+                                            : fraction);
+                    writer_io.DefineAttribute<double>("sampling/confidence",
+                                                      0.95);
+                }
+
                 if (write_inputvars)
                 {
                     var_u_out = writer_io.DefineVariable<double>(
-                        "U", {shape[0], shape[1], shape[2]}, {start1, 0, 0},
-                        {count1, shape[1], shape[2]});
+                        "U", {shape[0], shape[1], shape[2]});
                     var_v_out = writer_io.DefineVariable<double>(
-                        "V", {shape[0], shape[1], shape[2]}, {start1, 0, 0},
-                        {count1, shape[1], shape[2]});
+                        "V", {shape[0], shape[1], shape[2]});
                 }
                 firstStep = false;
             }
 
-            // Read adios2 data
-            reader.Get<double>(var_u_in, u);
-            reader.Get<double>(var_v_in, v);
-            if (shouldIWrite)
+            if (!rank)
             {
-                reader.Get<int>(var_step_in, &simStep);
+                std::cout << "PDF Analysis step " << stepAnalysis
+                          << " processing sim output step " << stepSimOut
+                          << " sim compute step " << simStep << ", waited "
+                          << reader.current_wait() << " s, skipped "
+                          << reader.current_skipped() << " steps";
+                if (reader.current_lag() >= 0)
+                {
+                    std::cout << ", " << reader.current_lag()
+                              << " steps behind";
+                }
+                std::cout << std::endl;
             }
 
-            // End adios2 step
-            reader.EndStep();
+            // Without metadata (e.g. HDF5) calculate min/max in one pass,
+            // and make it global unless each process uses its own bins
+            if (!have_minmax)
+            {
+                double mm[4] = {std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::max(),
+                                std::numeric_limits<double>::lowest(),
+                                std::numeric_limits<double>::lowest()};
+                for (const auto &box : boxes)
+                {
+                    double bmm[4];
+                    minmax_fused(box.u, box.v, bmm);
+                    mm[0] = std::min(mm[0], bmm[0]);
+                    mm[1] = std::min(mm[1], bmm[1]);
+                    mm[2] = std::max(mm[2], bmm[2]);
+                    mm[3] = std::max(mm[3], bmm[3]);
+                }
+                if (global_bins)
+                {
+                    // max as -min to reduce everything with one MPI_MIN
+                    double in[4] = {mm[0], mm[1], -mm[2], -mm[3]};
+                    MPI_Allreduce(in, mm, 4, MPI_DOUBLE, MPI_MIN, comm);
+                    mm[2] = -mm[2];
+                    mm[3] = -mm[3];
+                }
+                minmax_u = std::make_pair(mm[0], mm[2]);
+                minmax_v = std::make_pair(mm[1], mm[3]);
+            }
 
-            if (!rank)
+            // process owning slice z
+            auto owner = [&](const size_t z) {
+                return static_cast<int>(
+                    std::upper_bound(own_displs.begin(), own_displs.end(),
+                                     static_cast<int>(z)) -
+                    own_displs.begin() - 1);
+            };
+
+            // Compute the PDFs of the slices of each box into the slices of
+            // their owners, U and V of an owner next to each other
+            std::vector<uint64_t> counts(2 * shape[0] * nbins, 0);
+            unsigned long long outliers[2] = {0, 0}, total_outliers[2];
+            for (const auto &box : boxes)
             {
-                std::cout << "PDF Analysis step " << stepAnalysis
-                          << " processing sim output step " << stepSimOut
-                          << " sim compute step " << simStep << std::endl;
+                const size_t slice_size = box.count[1] * box.count[2];
+                const size_t zend = box.start[0] + box.count[0];
+                size_t z = box.start[0];
+                while (z < zend)
+                {
+                    // slices of the box owned by process r
+                    int r = owner(z);
+                    const size_t n = std::min(
+                        zend, static_cast<size_t>(own_displs[r] + own_counts[r])) - z;
+                    uint64_t *pdf_u =
+                        &counts[(2 * own_displs[r] + (z - own_displs[r])) *
+                                nbins];
+                    uint64_t *pdf_v = pdf_u + own_counts[r] * nbins;
+                    const size_t offset = (z - box.start[0]) * slice_size;
+                    outliers[0] += compute_pdf(
+                        box.u.data() + offset, n, slice_size, nbins,
+                        minmax_u.first, minmax_u.second, pdf_u, nthreads);
+                    outliers[1] += compute_pdf(
+                        box.v.data() + offset, n, slice_size, nbins,
+                        minmax_v.first, minmax_v.second, pdf_v, nthreads);
+                    z += n;
+                }
+            }
+
+            // Combine the partial PDFs on the owners of the slices, nothing
+            // to do if every process reads exactly its own slab
+            std::vector<uint64_t> own(2 * count1 * nbins);
+            if (own_slab)
+            {
+                std::copy(counts.begin() + 2 * start1 * nbins,
+                          counts.begin() + 2 * (start1 + count1) * nbins,
+                          own.begin());
+            }
+            else
+            {
+                std::vector<int> recvcounts(comm_size);
+                for (int r = 0; r < comm_size; ++r)
+                {
+                    recvcounts[r] = 2 * own_counts[r] * static_cast<int>(nbins);
+                }
+                MPI_Reduce_scatter(counts.data(), own.data(),
+                                   recvcounts.data(), MPI_UINT64_T, MPI_SUM,
+                                   comm);
+            }
+            std::vector<double> pdf_u(own.begin(), own.begin() + count1 * nbins);
+            std::vector<double> pdf_v(own.begin() + count1 * nbins, own.end());
+
+            // Scale a sample to the whole slices, with confidence bounds
+            // from the moments of the counts of its clusters, the part of a
+            // slice in a box. Per owner: cc and cn of U, of V, nn, m.
+            std::vector<double> lower_u, upper_u, lower_v, upper_v, samples;
+            if (sampling)
+            {
+                const size_t per_slice = 4 * nbins + 2;
+                std::vector<double> moments(shape[0] * per_slice, 0.0);
+                std::vector<uint64_t> hist;
+                for (const auto &box : boxes)
+                {
+                    const size_t slice_size = box.count[1] * box.count[2];
+                    const std::vector<double> *data[2] = {&box.u, &box.v};
+                    const std::pair<double, double> *mm[2] = {&minmax_u,
+                                                              &minmax_v};
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        hist.assign(box.count[0] * nbins, 0);
+                        compute_pdf(data[j]->data(), box.count[0], slice_size,
+                                    nbins, mm[j]->first, mm[j]->second,
+                                    hist.data(), nthreads);
+                        for (size_t s = 0; s < box.count[0]; ++s)
+                        {
+                            const size_t z = box.start[0] + s;
+                            const int r = owner(z);
+                            const size_t k = own_counts[r];
+                            const size_t i = z - own_displs[r];
+                            double *base = &moments[own_displs[r] * per_slice];
+                            const uint64_t *c = &hist[s * nbins];
+                            double n = 0.0;
+                            for (size_t b = 0; b < nbins; ++b)
+                            {
+                                n += c[b];
+                            }
+                            double *cc = base + (2 * j * k + i) * nbins;
+                            double *cn = base + ((2 * j + 1) * k + i) * nbins;
+                            for (size_t b = 0; b < nbins; ++b)
+                            {
+                                cc[b] += static_cast<double>(c[b]) * c[b];
+                                cn[b] += c[b] * n;
+                            }
+                            if (j == 0)
+                            {
+                                base[4 * k * nbins + i] += n * n;
+                                base[4 * k * nbins + k + i] += 1.0;
+                            }
+                        }
+                    }
+                }
+                std::vector<double> own_moments(count1 * per_slice);
+                std::vector<int> recvcounts(comm_size);
+                for (int r = 0; r < comm_size; ++r)
+                {
+                    recvcounts[r] = own_counts[r] * static_cast<int>(per_slice);
+                }
+                MPI_Reduce_scatter(moments.data(), own_moments.data(),
+                                   recvcounts.data(), MPI_DOUBLE, MPI_SUM,
+                                   comm);
+
+                const double slice_size = shape[1] * shape[2];
+                std::vector<double> *pdf[2] = {&pdf_u, &pdf_v};
+                std::vector<double> *lower[2] = {&lower_u, &lower_v};
+                std::vector<double> *upper[2] = {&upper_u, &upper_v};
+                const double *nn = &own_moments[4 * count1 * nbins];
+                const double *m = nn + count1;
+                samples.resize(count1);
+                double nsampled = 0.0, total_sampled;
+                for (int j = 0; j < 2; ++j)
+                {
+                    lower[j]->resize(count1 * nbins);
+                    upper[j]->resize(count1 * nbins);
+                    for (size_t i = 0; i < count1; ++i)
+                    {
+                        const size_t o = i * nbins;
+                        samples[i] = estimate_pdf(
+                            pdf[j]->data() + o, nbins, slice_size,
+                            &own_moments[2 * j * count1 * nbins + o],
+                            &own_moments[(2 * j + 1) * count1 * nbins + o],
+                            nn[i], m[i], lower[j]->data() + o,
+                            upper[j]->data() + o);
+                    }
+                }
+                for (double n : samples)
+                {
+                    nsampled += n;
+                }
+                MPI_Reduce(&nsampled, &total_sampled, 1, MPI_DOUBLE, MPI_SUM,
+                           0, comm);
+                if (!rank)
+                {
+                    const double total = shape[0] * slice_size;
+                    std::cout << "  approximate PDFs from " << total_sampled
+                              << " of " << total << " values ("
+                              << 100.0 * total_sampled / total << "%)"
+                              << std::endl;
+                }
             }
 
-            // HDF5 engine does not provide min/max. Let's calculate it
-            //        if (reader_io.EngineType() == "HDF5")
+            std::vector<double> bins_u, bins_v;
+            compute_bins(nbins, minmax_u.first, minmax_u.second, bins_u);
+            compute_bins(nbins, minmax_v.first, minmax_v.second, bins_v);
+
+            MPI_Reduce(outliers, total_outliers, 2, MPI_UNSIGNED_LONG_LONG,
+                       MPI_SUM, 0, comm);
+            if (!rank && (total_outliers[0] || total_outliers[1]))
             {
-                auto mmu = std::minmax_element(u.begin(), u.end());
-                minmax_u = std::make_pair(*mmu.first, *mmu.second);
-                auto mmv = std::minmax_element(v.begin(), v.end());
-                minmax_v = std::make_pair(*mmv.first, *mmv.second);
+                std::cout << "  values out of [min,max] not in the PDF: U "
+                          << total_outliers[0] << ", V " << total_outliers[1]
+                          << std::endl;
             }
 
-            // Compute PDF
-            std::vector<double> pdf_u;
-            std::vector<double> bins_u;
-            compute_pdf(u, shape, start1, count1, nbins, minmax_u.first,
-                        minmax_u.second, pdf_u, bins_u);
+            // Add the step to the statistics over time, with the bins of
+            // the global min/max of the first step unless given
+            bool emit_accumulated = false;
+            if (accum)
+            {
+                if (!accum->range_set())
+                {
+                    double lo[2] = {minmax_u.first, minmax_v.first};
+                    double hi[2] = {minmax_u.second, minmax_v.second};
+                    accum->set_range(lo, hi);
+                }
+                accum->add(boxes, shape[0], nthreads);
+                emit_accumulated =
+                    accumulate > 0 && accum->steps() % accumulate == 0;
+                if (emit_accumulated)
+                {
+                    accum->emit(own_counts, own_displs);
+                }
+            }
 
-            std::vector<double> pdf_v;
-            std::vector<double> bins_v;
-            compute_pdf(v, shape, start1, count1, nbins, minmax_v.first,
-                        minmax_v.second, pdf_v, bins_v);
+            if (sketches)
+            {
+                sketches->update(boxes, shape[0], own_counts, own_displs,
+                                 nthreads);
+                if (!rank)
+                {
+                    for (int j = 0; j < 2; ++j)
+                    {
+                        std::cout << (j ? "  V" : "  U") << " quantiles:";
+                        for (double q : sketches->global[j])
+                        {
+                            std::cout << " " << q;
+                        }
+                        std::cout << std::endl;
+                    }
+                }
+            }
 
             // write U, V, and their norms out
             writer.BeginStep();
-            writer.Put<double>(var_u_pdf, pdf_u.data());
-            writer.Put<double>(var_v_pdf, pdf_v.data());
+            if (count1)
+            {
+                writer.Put<double>(var_u_pdf, pdf_u.data());
+                writer.Put<double>(var_v_pdf, pdf_v.data());
+            }
             if (shouldIWrite)
             {
                 writer.Put<double>(var_u_bins, bins_u.data());
                 writer.Put<double>(var_v_bins, bins_v.data());
                 writer.Put<int>(var_step_out, simStep);
             }
+            if (sampling && count1)
+            {
+                writer.Put<double>(var_lower[0], lower_u.data());
+                writer.Put<double>(var_upper[0], upper_u.data());
+                writer.Put<double>(var_lower[1], lower_v.data());
+                writer.Put<double>(var_upper[1], upper_v.data());
+                writer.Put<double>(var_samples, samples.data());
+            }
+            if (sketches)
+            {
+                for (int j = 0; j < 2; ++j)
+                {
+                    if (count1)
+                    {
+                        writer.Put<double>(var_q_slice[j],
+                                           sketches->slice[j].data());
+                        writer.Put<double>(var_q_slice_running[j],
+                                           sketches->slice_running[j].data());
+                    }
+                    if (shouldIWrite)
+                    {
+                        writer.Put<double>(var_q_global[j],
+                                           sketches->global[j].data());
+                        writer.Put<double>(var_q_global_running[j],
+                                           sketches->global_running[j].data());
+                    }
+                }
+                if (shouldIWrite)
+                {
+                    writer.Put<double>(var_probs, probs.data());
+                }
+            }
+            if (emit_accumulated)
+            {
+                put_accumulated();
+            }
             if (write_inputvars)
             {
-                writer.Put<double>(var_u_out, u.data());
-                writer.Put<double>(var_v_out, v.data());
+                for (const auto &box : boxes)
+                {
+                    adios2::Box<adios2::Dims> sel(box.start, box.count);
+                    var_u_out.SetSelection(sel);
+                    var_v_out.SetSelection(sel);
+                    writer.Put<double>(var_u_out, box.u.data());
+                    writer.Put<double>(var_v_out, box.v.data());
+                }
             }
             writer.EndStep();
             ++stepAnalysis;
         }
 
+        // statistics of the steps after the last output
+        if (accum && accum->steps() > emitted_steps)
+        {
+            accum->emit(own_counts, own_displs);
+            writer.BeginStep();
+            put_accumulated();
+            if (shouldIWrite)
+            {
+                writer.Put<int>(var_step_out, simStep);
+            }
+            writer.EndStep();
+            if (!rank)
+            {
+                std::cout << "PDF analysis wrote statistics of "
+                          << accum->steps() << " steps" << std::endl;
+            }
+        }
+
         // cleanup
-        reader.Close();
+        reader.close();
         writer.Close();
+        if (!rank)
+        {
+            reader.wait_stats().print_summary(std::cout, "PDF analysis");
+        }
     }
 
     MPI_Barrier(comm);
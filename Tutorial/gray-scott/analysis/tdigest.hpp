@@ -0,0 +1,318 @@
+#ifndef __TDIGEST_HPP__
+#define __TDIGEST_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <mpi.h>
+
+/*
+ * t-digest, a mergeable sketch of a distribution for estimating quantiles
+ * (T. Dunning, O. Ertl: Computing extremely accurate quantiles using
+ * t-digests). The values are summarized in at most compression + 2
+ * centroids, small at the tails and large in the middle (k1 scale function),
+ * so extreme quantiles stay accurate. Digests of parts of the data can be
+ * merged, in any order.
+ *
+ * For MPI a digest is packed into a fixed number of doubles, see
+ * tdigest_datatype() and tdigest_op() for reductions of digests.
+ */
+class TDigest
+{
+public:
+    explicit TDigest(double compression = 100.0)
+    : compression(compression), total(0.0),
+      min(std::numeric_limits<double>::max()),
+      max(std::numeric_limits<double>::lowest())
+    {
+        buffer.reserve(buffer_limit());
+    }
+
+    void add(double x)
+    {
+        buffer.push_back(x);
+        if (buffer.size() >= buffer_limit())
+        {
+            flush();
+        }
+    }
+
+    template <class T>
+    void add(const T *x, size_t n)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            add(static_cast<double>(x[i]));
+        }
+    }
+
+    void merge(const TDigest &other)
+    {
+        std::vector<Centroid> all(centroids);
+        all.insert(all.end(), other.centroids.begin(), other.centroids.end());
+        for (double x : other.buffer)
+        {
+            all.push_back({x, 1.0});
+        }
+        for (double x : buffer)
+        {
+            all.push_back({x, 1.0});
+        }
+        buffer.clear();
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        for (double x : other.buffer)
+        {
+            min = std::min(min, x);
+            max = std::max(max, x);
+        }
+        compress(all);
+    }
+
+    // number of values
+    double count() const { return total + buffer.size(); }
+
+    /*
+     * Estimate of the q quantile (0 <= q <= 1), NaN without values
+     */
+    double quantile(double q)
+    {
+        flush();
+        const size_t n = centroids.size();
+        if (!n)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (n == 1)
+        {
+            return centroids[0].mean;
+        }
+
+        // centroids are at the middle of their weight; interpolate between
+        // them, and between the outer ones and min/max
+        const double index = std::min(std::max(q, 0.0), 1.0) * total;
+        const Centroid &first = centroids.front();
+        const Centroid &last = centroids.back();
+        if (index <= first.weight / 2)
+        {
+            return min + (first.mean - min) * index / (first.weight / 2);
+        }
+        if (index >= total - last.weight / 2)
+        {
+            return max - (max - last.mean) * (total - index) /
+                             (last.weight / 2);
+        }
+        double center = first.weight / 2;
+        for (size_t i = 0; i + 1 < n; ++i)
+        {
+            const double dw = (centroids[i].weight + centroids[i + 1].weight) / 2;
+            if (center + dw >= index)
+            {
+                const double t = (index - center) / dw;
+                return centroids[i].mean +
+                       t * (centroids[i + 1].mean - centroids[i].mean);
+            }
+            center += dw;
+        }
+        return last.mean;
+    }
+
+    // most centroids of a digest of the given compression
+    static size_t capacity(double compression)
+    {
+        return static_cast<size_t>(std::ceil(compression)) + 2;
+    }
+
+    // number of doubles of a packed digest
+    static size_t packed_size(double compression)
+    {
+        return 4 + 2 * capacity(compression);
+    }
+
+    /*
+     * {compression, ncentroids, min, max, means..., weights...} into
+     * packed_size(compression) doubles
+     */
+    void pack(double *buf)
+    {
+        flush();
+        const size_t cap = capacity(compression);
+        std::fill(buf, buf + packed_size(compression), 0.0);
+        buf[0] = compression;
+        buf[1] = static_cast<double>(centroids.size());
+        buf[2] = min;
+        buf[3] = max;
+        for (size_t i = 0; i < centroids.size(); ++i)
+        {
+            buf[4 + i] = centroids[i].mean;
+            buf[4 + cap + i] = centroids[i].weight;
+        }
+    }
+
+    static TDigest unpack(const double *buf)
+    {
+        TDigest d(buf[0]);
+        const size_t cap = capacity(d.compression);
+        const size_t n = static_cast<size_t>(buf[1]);
+        d.min = buf[2];
+        d.max = buf[3];
+        d.centroids.resize(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            d.centroids[i].mean = buf[4 + i];
+            d.centroids[i].weight = buf[4 + cap + i];
+            d.total += d.centroids[i].weight;
+        }
+        return d;
+    }
+
+private:
+    struct Centroid
+    {
+        double mean;
+        double weight;
+    };
+
+    double compression;
+    std::vector<Centroid> centroids; // sorted by mean
+    double total;                    // weight of the centroids
+    double min;
+    double max;
+    std::vector<double> buffer; // values not merged yet
+
+    size_t buffer_limit() const
+    {
+        return 5 * capacity(compression);
+    }
+
+    void flush()
+    {
+        if (buffer.empty())
+        {
+            return;
+        }
+        std::vector<Centroid> all(centroids);
+        for (double x : buffer)
+        {
+            all.push_back({x, 1.0});
+            min = std::min(min, x);
+            max = std::max(max, x);
+        }
+        buffer.clear();
+        compress(all);
+    }
+
+    // k1 scale function
+    double k(double q) const
+    {
+        return compression / (2 * M_PI) * std::asin(2 * q - 1);
+    }
+
+    /*
+     * Merge neighboring centroids as long as a centroid spans at most 1 in
+     * k, which bounds their number to compression + 2
+     */
+    void compress(std::vector<Centroid> &all)
+    {
+        centroids.clear();
+        total = 0.0;
+        if (all.empty())
+        {
+            return;
+        }
+        std::sort(all.begin(), all.end(),
+                  [](const Centroid &a, const Centroid &b) {
+                      return a.mean < b.mean;
+                  });
+        double w = 0.0;
+        for (const auto &c : all)
+        {
+            w += c.weight;
+        }
+
+        Centroid cur = all[0];
+        double done = 0.0; // weight of the centroids before cur
+        double k_left = k(0.0);
+        for (size_t i = 1; i < all.size(); ++i)
+        {
+            const double right = (done + cur.weight + all[i].weight) / w;
+            if (k(std::min(right, 1.0)) - k_left <= 1.0)
+            {
+                cur.mean += (all[i].mean - cur.mean) * all[i].weight /
+                            (cur.weight + all[i].weight);
+                cur.weight += all[i].weight;
+            }
+            else
+            {
+                done += cur.weight;
+                centroids.push_back(cur);
+                k_left = k(done / w);
+                cur = all[i];
+            }
+        }
+        centroids.push_back(cur);
+        total = w;
+
+        // the k bound holds up to rounding; rather than fail (this also runs
+        // in the MPI reduction), merge the lightest neighbors until it fits
+        while (centroids.size() > capacity(compression))
+        {
+            size_t j = 0;
+            for (size_t i = 1; i + 1 < centroids.size(); ++i)
+            {
+                if (centroids[i].weight + centroids[i + 1].weight <
+                    centroids[j].weight + centroids[j + 1].weight)
+                {
+                    j = i;
+                }
+            }
+            Centroid &c = centroids[j];
+            const Centroid &d = centroids[j + 1];
+            c.mean += (d.mean - c.mean) * d.weight / (c.weight + d.weight);
+            c.weight += d.weight;
+            centroids.erase(centroids.begin() + j + 1);
+        }
+    }
+};
+
+/*
+ * MPI datatype of a packed digest of the given compression
+ */
+inline MPI_Datatype tdigest_datatype(double compression)
+{
+    MPI_Datatype type;
+    MPI_Type_contiguous(static_cast<int>(TDigest::packed_size(compression)),
+                        MPI_DOUBLE, &type);
+    MPI_Type_commit(&type);
+    return type;
+}
+
+inline void tdigest_merge(void *in, void *inout, int *len, MPI_Datatype *type)
+{
+    int size;
+    MPI_Type_size(*type, &size);
+    const size_t n = size / sizeof(double);
+    const double *a = static_cast<const double *>(in);
+    double *b = static_cast<double *>(inout);
+    for (int i = 0; i < *len; ++i)
+    {
+        TDigest d = TDigest::unpack(b + i * n);
+        d.merge(TDigest::unpack(a + i * n));
+        d.pack(b + i * n);
+    }
+}
+
+/*
+ * Reduction operator merging packed digests of a tdigest_datatype()
+ */
+inline MPI_Op tdigest_op()
+{
+    MPI_Op op;
+    MPI_Op_create(&tdigest_merge, 1, &op);
+    return op;
+}
+
+#endif
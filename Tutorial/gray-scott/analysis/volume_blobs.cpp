@@ -0,0 +1,304 @@
+/*
+ * Analysis code for the Gray-Scott simulation.
+ * Reads variable U or V and finds the blobs above (or below) a threshold
+ * directly on the volume, in parallel.
+ * Writes the number of blobs and the volume and surface area of each blob
+ * using ADIOS.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+#include "../common/step_reader.hpp"
+#include "../common/timer.hpp"
+#include "pdf.hpp"
+#include "volume_blobs.hpp"
+
+/*
+ * Box of U or V of this process, the same for all steps
+ */
+struct InputStep
+{
+    adios2::Dims shape;
+    adios2::Dims start;
+    adios2::Dims count;
+    std::vector<double> data;
+    int step = 0;
+};
+
+int main(int argc, char *argv[])
+{
+    // steps are read ahead in a background thread
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+
+    int rank, procs, wrank;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &wrank);
+
+    const unsigned int color = 8;
+    MPI_Comm comm;
+    MPI_Comm_split(MPI_COMM_WORLD, color, wrank, &comm);
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &procs);
+
+    int dims[3] = {0};
+    MPI_Dims_create(procs, 3, dims);
+    int periods[3] = {0};
+    MPI_Comm cart_comm;
+    MPI_Cart_create(comm, 3, dims, periods, 0, &cart_comm);
+    int coords[3] = {0};
+    MPI_Cart_coords(cart_comm, rank, 3, coords);
+
+    // --below, --prefetch=P and --wait=... can be anywhere, the rest are
+    // positional arguments
+    std::vector<std::string> args;
+    bool below = false;
+    int prefetch = 1;
+    WaitPolicy wait_policy;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            std::string arg = argv[i];
+            if (arg == "--below")
+            {
+                below = true;
+            }
+            else if (arg.compare(0, 11, "--prefetch=") == 0)
+            {
+                prefetch = std::max(0, std::stoi(arg.substr(11)));
+            }
+            else if (!parse_wait_option(arg, wait_policy))
+            {
+                args.push_back(arg);
+            }
+        }
+        if (args.size() >= 3 && args[2] != "U" && args[2] != "V")
+        {
+            throw std::invalid_argument("ERROR: volume_blobs reads U or V, "
+                                        "not " +
+                                        args[2] + "\n");
+        }
+    }
+    catch (std::exception &e)
+    {
+        if (rank == 0)
+        {
+            std::cerr << e.what() << std::endl;
+        }
+        MPI_Abort(MPI_COMM_WORLD, -1);
+    }
+
+    if (args.size() < 4)
+    {
+        if (rank == 0)
+        {
+            std::cerr << "Too few arguments" << std::endl;
+            std::cout << "Usage: volume_blobs input output U|V threshold "
+                         "[--below] [--prefetch=P] [--wait=I[:M[:F[:G]]]]"
+                      << std::endl;
+            std::cout << "  --below: blobs of the voxels below the "
+                         "threshold, default = above"
+                      << std::endl;
+            std::cout << "  --prefetch=P: steps read ahead in the "
+                         "background, default = 1"
+                      << std::endl;
+            std::cout << "  --wait: BeginStep timeout from I to M seconds, "
+                         "growing by F, give up after G seconds,"
+                      << std::endl;
+            std::cout << "          default = 0.1:10:2:-1 (never)"
+                      << std::endl;
+        }
+        MPI_Abort(MPI_COMM_WORLD, -1);
+    }
+
+    const std::string input_fname(args[0]);
+    const std::string output_fname(args[1]);
+    const std::string var_name(args[2]);
+    const double threshold = std::stod(args[3]);
+
+    adios2::ADIOS adios("adios2.xml", comm);
+
+    auto read_input = [&](adios2::IO &io, adios2::Engine &reader,
+                          InputStep &in) {
+        adios2::Variable<double> var = io.InquireVariable<double>(var_name);
+        adios2::Variable<int> varStep = io.InquireVariable<int>("step");
+
+        in.shape = var.Shape();
+        in.start.resize(3);
+        in.count.resize(3);
+        for (int d = 0; d < 3; ++d)
+        {
+            partition(in.shape[d], dims[d], coords[d], in.start[d],
+                      in.count[d]);
+        }
+        var.SetSelection({in.start, in.count});
+        reader.Get<double>(var, in.data);
+        reader.Get<int>(varStep, &in.step);
+    };
+
+    adios2::IO inIO = adios.DeclareIO("SimulationOutput");
+    StepReader<InputStep> reader(inIO, input_fname, comm, read_input, prefetch,
+                                 true, wait_policy);
+
+    adios2::IO outIO = adios.DeclareIO("VolumeBlobsOutput");
+    adios2::Engine writer = outIO.Open(output_fname, adios2::Mode::Write);
+
+    auto var_nblobs = outIO.DefineVariable<int>("nblobs");
+    auto var_label = outIO.DefineVariable<uint64_t>("label", {1}, {0}, {1});
+    auto var_volume = outIO.DefineVariable<uint64_t>("volume", {1}, {0}, {1});
+    auto var_area = outIO.DefineVariable<double>("area", {1}, {0}, {1});
+    auto var_step = outIO.DefineVariable<int>("step");
+
+    // reused for all steps
+    BlobFinder finder(cart_comm);
+    std::vector<uint64_t> labels, volumes;
+    std::vector<double> areas;
+
+#ifdef ENABLE_TIMERS
+    Timer timer_total;
+    Timer timer_read;
+    Timer timer_compute;
+    Timer timer_write;
+
+    std::ostringstream log_fname;
+    log_fname << "volume_blobs_pe_" << rank << ".log";
+
+    std::ofstream log(log_fname.str());
+    log << "step\ttotal_blobs\tread_blobs\tcompute_blobs\twrite_blobs"
+        << std::endl;
+#endif
+
+    while (true)
+    {
+#ifdef ENABLE_TIMERS
+        MPI_Barrier(comm);
+        timer_total.start();
+        timer_read.start();
+#endif
+
+        InputStep *in = reader.next();
+        if (!in)
+        {
+            break;
+        }
+
+#ifdef ENABLE_TIMERS
+        double time_read = timer_read.stop();
+        MPI_Barrier(comm);
+        timer_compute.start();
+#endif
+
+        const std::vector<Blob> blobs =
+            finder.find(in->data.data(), in->shape, in->start, in->count,
+                        threshold, below);
+
+        labels.clear();
+        volumes.clear();
+        areas.clear();
+        for (const auto &blob : blobs)
+        {
+            labels.push_back(blob.label);
+            volumes.push_back(blob.volume);
+            areas.push_back(blob.area());
+        }
+
+        // the largest blob, for the log
+        struct
+        {
+            double volume;
+            int rank;
+        } largest = {-1.0, rank}, top;
+        double largest_area = 0.0;
+        for (const auto &blob : blobs)
+        {
+            if (static_cast<double>(blob.volume) > largest.volume)
+            {
+                largest.volume = static_cast<double>(blob.volume);
+                largest_area = blob.area();
+            }
+        }
+        MPI_Allreduce(&largest, &top, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
+        MPI_Bcast(&largest_area, 1, MPI_DOUBLE, top.rank, comm);
+
+#ifdef ENABLE_TIMERS
+        double time_compute = timer_compute.stop();
+        MPI_Barrier(comm);
+        timer_write.start();
+#endif
+
+        // the blobs of each process after those of the lower ranks
+        unsigned long long n = blobs.size(), total, first = 0;
+        MPI_Allreduce(&n, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+        MPI_Exscan(&n, &first, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+        if (!rank)
+        {
+            first = 0;
+            std::cout << "volume_blobs at step " << in->step << " found "
+                      << total << " blobs";
+            if (total)
+            {
+                std::cout << ", largest "
+                          << static_cast<unsigned long long>(top.volume)
+                          << " voxels, area "
+                          << largest_area;
+            }
+            std::cout << std::endl;
+        }
+
+        writer.BeginStep();
+        var_label.SetShape({total});
+        var_label.SetSelection({{first}, {n}});
+        var_volume.SetShape({total});
+        var_volume.SetSelection({{first}, {n}});
+        var_area.SetShape({total});
+        var_area.SetSelection({{first}, {n}});
+        if (n)
+        {
+            writer.Put<uint64_t>(var_label, labels.data());
+            writer.Put<uint64_t>(var_volume, volumes.data());
+            writer.Put<double>(var_area, areas.data());
+        }
+        if (!rank)
+        {
+            writer.Put<int>(var_nblobs, static_cast<int>(total));
+            writer.Put<int>(var_step, in->step);
+        }
+        writer.EndStep();
+
+#ifdef ENABLE_TIMERS
+        double time_write = timer_write.stop();
+        double time_step = timer_total.stop();
+        MPI_Barrier(comm);
+
+        log << in->step << "\t" << time_step << "\t" << time_read << "\t"
+            << time_compute << "\t" << time_write << std::endl;
+#endif
+    }
+
+#ifdef ENABLE_TIMERS
+    log << "total\t" << timer_total.elapsed() << "\t" << timer_read.elapsed()
+        << "\t" << timer_compute.elapsed() << "\t" << timer_write.elapsed()
+        << std::endl;
+
+    log.close();
+#endif
+
+    writer.Close();
+    reader.close();
+    if (!rank)
+    {
+        reader.wait_stats().print_summary(std::cout, "volume_blobs");
+    }
+
+    MPI_Comm_free(&cart_comm);
+    MPI_Finalize();
+}
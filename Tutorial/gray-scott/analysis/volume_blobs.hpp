@@ -0,0 +1,487 @@
+#ifndef __VOLUME_BLOBS_HPP__
+#define __VOLUME_BLOBS_HPP__
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <adios2.h>
+#include <mpi.h>
+
+/*
+ * Blobs of a 3D array distributed over the processes in boxes on a
+ * cartesian grid: the connected components of the voxels above (or below) a
+ * threshold, with face neighbors connected.
+ *
+ * Each process labels the voxels of its box with a union-find in memory
+ * order, whose roots are the first voxels of the components, so a component
+ * is labeled by the global index of its first voxel. The labels on the faces
+ * of the boxes are exchanged with the neighbor processes, and the pairs of
+ * labels meeting at the faces are merged by a union-find reduced along a
+ * binary tree of the processes. The volume and voxel faces of each part of a
+ * blob are summed at a home process given by the label of the blob.
+ */
+
+struct Blob
+{
+    uint64_t label;  // global index of the first voxel
+    uint64_t volume; // voxels
+    uint64_t faces;  // voxel faces between the blob and the background
+
+    // estimate of the area of the surface of the blob: the voxel faces
+    // overestimate the area of a surface of random orientation by 3/2
+    double area() const { return faces * 2.0 / 3.0; }
+};
+
+class BlobFinder
+{
+public:
+    // cart_comm is a 3D cartesian communicator without periods
+    explicit BlobFinder(MPI_Comm cart_comm) : comm(cart_comm)
+    {
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &nproc);
+        for (int d = 0; d < 3; ++d)
+        {
+            MPI_Cart_shift(comm, d, 1, &lower[d], &upper[d]);
+        }
+    }
+
+    /*
+     * The blobs of an array of the given shape, whose part in the box of
+     * this process, at its place on the grid of cart_comm, is data; returns
+     * those whose home is this process, ordered by label. Collective.
+     */
+    template <class T>
+    std::vector<Blob> find(const T *data, const adios2::Dims &shape,
+                           const adios2::Dims &start,
+                           const adios2::Dims &count, double threshold,
+                           bool below)
+    {
+        this->shape = shape;
+        this->start = start;
+        this->count = count;
+        label_box(data, threshold, below);
+        exchange_faces();
+        count_parts();
+        merge_labels();
+        return sum_parts();
+    }
+
+private:
+    MPI_Comm comm;
+    int rank, nproc;
+    adios2::Dims shape, start, count;
+    int lower[3], upper[3];
+
+    // component of each voxel, -1 for the background, and the parts of
+    // the blobs in the box
+    std::vector<int> ids;
+    std::vector<Blob> parts;
+
+    // labels + 1 on the faces of the neighbors next to the box, 0 for the
+    // background, by dimension
+    std::vector<uint64_t> lower_faces[3], upper_faces[3];
+
+    // pairs of labels that meet at the faces, both processes of a face
+    // have them, and the union-find of their labels
+    std::vector<std::pair<uint64_t, uint64_t>> edges;
+    std::unordered_map<uint64_t, uint64_t> parent;
+
+    size_t index(size_t z, size_t y, size_t x) const
+    {
+        return (z * count[1] + y) * count[2] + x;
+    }
+
+    // the two other dimensions of a face normal to d
+    static void face_dims(int d, int &a, int &b)
+    {
+        a = d == 0 ? 1 : 0;
+        b = d == 2 ? 1 : 2;
+    }
+
+    template <class T>
+    void label_box(const T *data, double threshold, bool below)
+    {
+        const size_t n = count[0] * count[1] * count[2];
+        const size_t sy = count[2], sz = count[1] * count[2];
+        ids.resize(n);
+
+        // union-find with the smaller root as parent, so parents come
+        // before their voxels
+        auto root = [this](size_t i) {
+            while (ids[i] != static_cast<int>(i))
+            {
+                ids[i] = ids[ids[i]];
+                i = ids[i];
+            }
+            return i;
+        };
+        auto unite = [&](size_t a, size_t b) {
+            a = root(a);
+            b = root(b);
+            if (a < b)
+            {
+                ids[b] = static_cast<int>(a);
+            }
+            else if (b < a)
+            {
+                ids[a] = static_cast<int>(b);
+            }
+        };
+
+        for (size_t z = 0; z < count[0]; ++z)
+        {
+            for (size_t y = 0; y < count[1]; ++y)
+            {
+                for (size_t x = 0; x < count[2]; ++x)
+                {
+                    const size_t i = index(z, y, x);
+                    const bool in =
+                        below ? data[i] < threshold : data[i] > threshold;
+                    if (!in)
+                    {
+                        ids[i] = -1;
+                        continue;
+                    }
+                    ids[i] = static_cast<int>(i);
+                    if (x > 0 && ids[i - 1] >= 0)
+                    {
+                        unite(i - 1, i);
+                    }
+                    if (y > 0 && ids[i - sy] >= 0)
+                    {
+                        unite(i - sy, i);
+                    }
+                    if (z > 0 && ids[i - sz] >= 0)
+                    {
+                        unite(i - sz, i);
+                    }
+                }
+            }
+        }
+
+        // roots to components, in the order of their first voxels
+        parts.clear();
+        for (size_t z = 0; z < count[0]; ++z)
+        {
+            for (size_t y = 0; y < count[1]; ++y)
+            {
+                for (size_t x = 0; x < count[2]; ++x)
+                {
+                    const size_t i = index(z, y, x);
+                    if (ids[i] < 0)
+                    {
+                        continue;
+                    }
+                    if (ids[i] == static_cast<int>(i))
+                    {
+                        const uint64_t label =
+                            ((start[0] + z) * shape[1] + start[1] + y) *
+                                shape[2] +
+                            start[2] + x;
+                        ids[i] = static_cast<int>(parts.size());
+                        parts.push_back({label, 0, 0});
+                    }
+                    else
+                    {
+                        // the parent is a root, already numbered
+                        ids[i] = ids[ids[i]];
+                    }
+                }
+            }
+        }
+    }
+
+    // the labels + 1 of the voxels of the face of the box at layer l of d
+    void face_labels(int d, size_t l, std::vector<uint64_t> &face) const
+    {
+        int a, b;
+        face_dims(d, a, b);
+        face.assign(count[a] * count[b], 0);
+        if (!count[d])
+        {
+            return;
+        }
+        size_t p[3];
+        p[d] = l;
+        for (size_t i = 0; i < count[a]; ++i)
+        {
+            for (size_t j = 0; j < count[b]; ++j)
+            {
+                p[a] = i;
+                p[b] = j;
+                const int id = ids[index(p[0], p[1], p[2])];
+                face[i * count[b] + j] = id < 0 ? 0 : parts[id].label + 1;
+            }
+        }
+    }
+
+    void exchange_faces()
+    {
+        std::vector<uint64_t> send;
+        for (int d = 0; d < 3; ++d)
+        {
+            int a, b;
+            face_dims(d, a, b);
+            const int size = static_cast<int>(count[a] * count[b]);
+            lower_faces[d].assign(size, 0);
+            upper_faces[d].assign(size, 0);
+
+            // the lower face down, the upper face of the process above up
+            face_labels(d, 0, send);
+            MPI_Sendrecv(send.data(), size, MPI_UINT64_T, lower[d], d,
+                         upper_faces[d].data(), size, MPI_UINT64_T, upper[d],
+                         d, comm, MPI_STATUS_IGNORE);
+            face_labels(d, count[d] ? count[d] - 1 : 0, send);
+            MPI_Sendrecv(send.data(), size, MPI_UINT64_T, upper[d], 3 + d,
+                         lower_faces[d].data(), size, MPI_UINT64_T, lower[d],
+                         3 + d, comm, MPI_STATUS_IGNORE);
+        }
+    }
+
+    // volume and faces of the parts, and the pairs of labels at the faces
+    void count_parts()
+    {
+        edges.clear();
+        const size_t stride[3] = {count[1] * count[2], count[2], 1};
+        size_t p[3];
+        for (p[0] = 0; p[0] < count[0]; ++p[0])
+        {
+            for (p[1] = 0; p[1] < count[1]; ++p[1])
+            {
+                for (p[2] = 0; p[2] < count[2]; ++p[2])
+                {
+                    const size_t i = index(p[0], p[1], p[2]);
+                    const int id = ids[i];
+                    if (id < 0)
+                    {
+                        continue;
+                    }
+                    Blob &part = parts[id];
+                    ++part.volume;
+                    for (int d = 0; d < 3; ++d)
+                    {
+                        int a, b;
+                        face_dims(d, a, b);
+                        const size_t f = p[a] * count[b] + p[b];
+
+                        // faces on the boundary of the array do not count
+                        if (p[d] > 0)
+                        {
+                            part.faces += ids[i - stride[d]] < 0;
+                        }
+                        else if (start[d] > 0)
+                        {
+                            const uint64_t next = lower_faces[d][f];
+                            part.faces += next == 0;
+                            if (next)
+                            {
+                                edges.emplace_back(part.label, next - 1);
+                            }
+                        }
+                        if (p[d] + 1 < count[d])
+                        {
+                            part.faces += ids[i + stride[d]] < 0;
+                        }
+                        else if (start[d] + count[d] < shape[d])
+                        {
+                            const uint64_t next = upper_faces[d][f];
+                            part.faces += next == 0;
+                            if (next)
+                            {
+                                edges.emplace_back(part.label, next - 1);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    }
+
+    uint64_t root(uint64_t x)
+    {
+        auto it = parent.find(x);
+        if (it == parent.end())
+        {
+            parent.emplace(x, x);
+            return x;
+        }
+        while (it->second != x)
+        {
+            const uint64_t next = it->second;
+            auto up = parent.find(next);
+            it->second = up->second;
+            x = next;
+            it = up;
+        }
+        return x;
+    }
+
+    void unite(uint64_t a, uint64_t b)
+    {
+        a = root(a);
+        b = root(b);
+        if (a != b)
+        {
+            parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+    /*
+     * Final labels of the labels in the pairs of all processes. The union
+     * of each process goes to the process below it in a binary tree, as
+     * pairs of a label and its root; the process at the top finds the final
+     * labels, which go back down for the labels each process sent.
+     */
+    void merge_labels()
+    {
+        parent.clear();
+        for (const auto &e : edges)
+        {
+            unite(e.first, e.second);
+        }
+
+        std::vector<std::pair<int, std::vector<uint64_t>>> children;
+        std::vector<uint64_t> sent, buffer;
+        int up = -1;
+        for (int k = 1; k < nproc; k <<= 1)
+        {
+            if (rank % (2 * k))
+            {
+                up = rank - k;
+                sent.clear();
+                for (const auto &p : parent)
+                {
+                    sent.push_back(p.first);
+                }
+                buffer.clear();
+                for (uint64_t x : sent)
+                {
+                    buffer.push_back(x);
+                    buffer.push_back(root(x));
+                }
+                send_vector(buffer, up);
+                break;
+            }
+            if (rank + k < nproc)
+            {
+                recv_vector(buffer, rank + k);
+                children.emplace_back(rank + k, std::vector<uint64_t>());
+                for (size_t i = 0; i + 1 < buffer.size(); i += 2)
+                {
+                    children.back().second.push_back(buffer[i]);
+                    unite(buffer[i], buffer[i + 1]);
+                }
+            }
+        }
+
+        std::unordered_map<uint64_t, uint64_t> final_labels;
+        if (up >= 0)
+        {
+            recv_vector(buffer, up);
+            for (size_t i = 0; i < sent.size(); ++i)
+            {
+                final_labels[sent[i]] = buffer[i];
+            }
+        }
+        auto resolve = [&](uint64_t x) {
+            return up >= 0 ? final_labels.at(x) : root(x);
+        };
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+        {
+            buffer.clear();
+            for (uint64_t x : it->second)
+            {
+                buffer.push_back(resolve(root(x)));
+            }
+            send_vector(buffer, it->first);
+        }
+
+        for (auto &part : parts)
+        {
+            if (parent.count(part.label))
+            {
+                part.label = resolve(root(part.label));
+            }
+        }
+    }
+
+    void send_vector(const std::vector<uint64_t> &v, int to)
+    {
+        unsigned long long n = v.size();
+        MPI_Send(&n, 1, MPI_UNSIGNED_LONG_LONG, to, 6, comm);
+        MPI_Send(v.data(), static_cast<int>(n), MPI_UINT64_T, to, 7, comm);
+    }
+
+    void recv_vector(std::vector<uint64_t> &v, int from)
+    {
+        unsigned long long n;
+        MPI_Recv(&n, 1, MPI_UNSIGNED_LONG_LONG, from, 6, comm,
+                 MPI_STATUS_IGNORE);
+        v.resize(n);
+        MPI_Recv(v.data(), static_cast<int>(n), MPI_UINT64_T, from, 7, comm,
+                 MPI_STATUS_IGNORE);
+    }
+
+    // the parts summed at the home processes of their labels
+    std::vector<Blob> sum_parts()
+    {
+        auto home = [this](uint64_t label) {
+            return static_cast<int>(((label * 0x9E3779B97F4A7C15ull) >> 32) %
+                                    static_cast<uint64_t>(nproc));
+        };
+
+        std::vector<std::vector<uint64_t>> lists(nproc);
+        for (const auto &part : parts)
+        {
+            auto &list = lists[home(part.label)];
+            list.push_back(part.label);
+            list.push_back(part.volume);
+            list.push_back(part.faces);
+        }
+        std::vector<int> scounts(nproc), sdispls(nproc), rcounts(nproc),
+            rdispls(nproc);
+        std::vector<uint64_t> send, recv;
+        for (int r = 0; r < nproc; ++r)
+        {
+            scounts[r] = static_cast<int>(lists[r].size());
+            sdispls[r] = static_cast<int>(send.size());
+            send.insert(send.end(), lists[r].begin(), lists[r].end());
+        }
+        MPI_Alltoall(scounts.data(), 1, MPI_INT, rcounts.data(), 1, MPI_INT,
+                     comm);
+        int total = 0;
+        for (int r = 0; r < nproc; ++r)
+        {
+            rdispls[r] = total;
+            total += rcounts[r];
+        }
+        recv.resize(total);
+        MPI_Alltoallv(send.data(), scounts.data(), sdispls.data(),
+                      MPI_UINT64_T, recv.data(), rcounts.data(),
+                      rdispls.data(), MPI_UINT64_T, comm);
+
+        std::unordered_map<uint64_t, size_t> index;
+        std::vector<Blob> blobs;
+        for (size_t i = 0; i + 2 < recv.size(); i += 3)
+        {
+            auto it = index.emplace(recv[i], blobs.size());
+            if (it.second)
+            {
+                blobs.push_back({recv[i], 0, 0});
+            }
+            blobs[it.first->second].volume += recv[i + 1];
+            blobs[it.first->second].faces += recv[i + 2];
+        }
+        std::sort(blobs.begin(), blobs.end(),
+                  [](const Blob &a, const Blob &b) { return a.label < b.label; });
+        return blobs;
+    }
+};
+
+#endif
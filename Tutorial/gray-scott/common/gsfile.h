@@ -0,0 +1,121 @@
+#ifndef __GSFILE_H__
+#define __GSFILE_H__
+
+/*
+ * Layout of the native MPI-IO output file of gray-scott (name.gs)
+ *
+ *   header                       (struct header, written at open/close)
+ *   step 0:  U[z][y][x]  V[z][y][x]
+ *   step 1:  U[z][y][x]  V[z][y][x]
+ *   ...
+ *   index                        (nsteps x struct index_entry, footer)
+ *
+ * The header is rewritten at close with the number of steps and the offset
+ * of the index. A file with index_offset == 0 was not closed properly.
+ *
+ * With subfiling (nsubfiles > 0) name.gs only holds the metadata
+ *
+ *   header
+ *   blocks                       (nblocks x struct block_entry)
+ *   index                        (nsteps x struct index_entry)
+ *
+ * and the data is in name.gs.0 ... name.gs.<nsubfiles-1>. A subfile holds
+ * one record per step, each the blocks of one group of writers, each block
+ * U[z][y][x] followed by V[z][y][x] of the block.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace gsfile
+{
+
+static const char magic[8] = "GSMPIIO";
+static const uint64_t version = 1;
+static const int num_vars = 2;
+static const char var_names[num_vars][8] = {"U", "V"};
+
+struct header
+{
+    char magic[8];
+    uint64_t version;
+    // original coder used z as slowest dim, x as fastest!!!
+    uint64_t z;
+    uint64_t y;
+    uint64_t x;
+    uint64_t nvars;
+    char varnames[num_vars][8];
+    uint64_t nsteps;
+    uint64_t index_offset;
+    // subfiling, all 0 for a single shared file
+    uint64_t nsubfiles;
+    uint64_t nblocks;
+    uint64_t blocks_offset;
+    // simulation parameters
+    double F;
+    double k;
+    double dt;
+    double Du;
+    double Dv;
+    double noise;
+};
+
+struct index_entry
+{
+    uint64_t step;   // simulation step
+    uint64_t offset; // byte offset of the step in file, or record in subfiles
+    double min[num_vars];
+    double max[num_vars];
+};
+
+struct block_entry
+{
+    uint64_t subfile;  // data is in name.gs.<subfile>
+    uint64_t offset;   // byte offset of the block in a record of the subfile
+    uint64_t stride;   // size of one record (step) of the subfile in bytes
+    uint64_t start[3]; // z, y, x
+    uint64_t count[3];
+};
+
+inline void init_header(header &h, uint64_t L)
+{
+    std::memset(&h, 0, sizeof(h));
+    std::memcpy(h.magic, magic, sizeof(magic));
+    h.version = version;
+    h.z = L;
+    h.y = L;
+    h.x = L;
+    h.nvars = num_vars;
+    std::memcpy(h.varnames, var_names, sizeof(var_names));
+}
+
+inline bool check_header(const header &h)
+{
+    return !std::memcmp(h.magic, magic, sizeof(magic)) &&
+           h.version == version && h.nvars == num_vars;
+}
+
+/* size of one variable in one step in bytes */
+inline uint64_t var_size(const header &h)
+{
+    return h.z * h.y * h.x * sizeof(double);
+}
+
+/* size of one step in bytes */
+inline uint64_t step_size(const header &h) { return h.nvars * var_size(h); }
+
+/* size of one variable in one block in bytes */
+inline uint64_t var_size(const block_entry &b)
+{
+    return b.count[0] * b.count[1] * b.count[2] * sizeof(double);
+}
+
+inline std::string subfile_name(const std::string &fname, uint64_t subfile)
+{
+    return fname + "." + std::to_string(subfile);
+}
+
+} // end namespace gsfile
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef __MESH_ENCODING_HPP__
+#define __MESH_ENCODING_HPP__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+
+/*
+ * Compact encoding of the isosurface output, written instead of point,
+ * normal and cell by isosurface --encoding=compact:
+ *
+ *   point_box[B][7]   int     per block of points its first point and its
+ *                             box, lower and upper corner (x, y, z)
+ *   point_q[N][3]     uint16  positions quantized in the box of their block
+ *   normal_oct[N][2]  int16   unit normals, octahedral
+ *   cell_code[C]      uint8   point ids of the cells, each as the zigzag
+ *                             varint of its difference to the one before
+ *
+ * The points of a block are those from its first point to the first point
+ * of the next block. The cells of all processes form one code.
+ *
+ * Levels of detail of the mesh, isosurface --lod=..., have the same
+ * variables prefixed by lod1/, lod2/, ...
+ */
+
+const double quantize_steps = 65535.0;
+
+inline void encode_points(const double *points, size_t n, const int *box,
+                          uint16_t *q)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (int d = 0; d < 3; ++d)
+        {
+            const double t =
+                (points[3 * i + d] - box[d]) / (box[3 + d] - box[d]);
+            q[3 * i + d] = static_cast<uint16_t>(
+                std::lround(std::min(std::max(t, 0.0), 1.0) * quantize_steps));
+        }
+    }
+}
+
+inline void decode_points(const uint16_t *q, size_t n, const int *box,
+                          double *points)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        for (int d = 0; d < 3; ++d)
+        {
+            points[3 * i + d] =
+                box[d] + q[3 * i + d] / quantize_steps * (box[3 + d] - box[d]);
+        }
+    }
+}
+
+// unit normal onto the octahedron, whose lower half is folded up
+inline void encode_normal(const double *nrm, int16_t *oct)
+{
+    const double len =
+        std::abs(nrm[0]) + std::abs(nrm[1]) + std::abs(nrm[2]);
+    double x = len > 0.0 ? nrm[0] / len : 0.0;
+    double y = len > 0.0 ? nrm[1] / len : 0.0;
+    if (len > 0.0 && nrm[2] < 0.0)
+    {
+        const double fx = (1.0 - std::abs(y)) * (x < 0.0 ? -1.0 : 1.0);
+        const double fy = (1.0 - std::abs(x)) * (y < 0.0 ? -1.0 : 1.0);
+        x = fx;
+        y = fy;
+    }
+    oct[0] = static_cast<int16_t>(std::lround(x * 32767.0));
+    oct[1] = static_cast<int16_t>(std::lround(y * 32767.0));
+}
+
+inline void decode_normal(const int16_t *oct, double *nrm)
+{
+    double x = oct[0] / 32767.0, y = oct[1] / 32767.0;
+    const double z = 1.0 - std::abs(x) - std::abs(y);
+    if (z < 0.0)
+    {
+        const double fx = (1.0 - std::abs(y)) * (x < 0.0 ? -1.0 : 1.0);
+        const double fy = (1.0 - std::abs(x)) * (y < 0.0 ? -1.0 : 1.0);
+        x = fx;
+        y = fy;
+    }
+    const double len = std::sqrt(x * x + y * y + z * z);
+    nrm[0] = x / len;
+    nrm[1] = y / len;
+    nrm[2] = z / len;
+}
+
+// appends the code of n point ids, following prev
+inline void encode_cells(const int *cells, size_t n, int prev,
+                         std::vector<uint8_t> &code)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        const int64_t delta = static_cast<int64_t>(cells[i]) - prev;
+        uint64_t z = delta < 0 ? (static_cast<uint64_t>(-delta) << 1) - 1
+                               : static_cast<uint64_t>(delta) << 1;
+        while (z >= 0x80)
+        {
+            code.push_back(static_cast<uint8_t>(z | 0x80));
+            z >>= 7;
+        }
+        code.push_back(static_cast<uint8_t>(z));
+        prev = cells[i];
+    }
+}
+
+inline void decode_cells(const uint8_t *code, size_t size,
+                         std::vector<int> &cells)
+{
+    cells.clear();
+    int64_t prev = 0;
+    for (size_t i = 0; i < size;)
+    {
+        uint64_t z = 0;
+        int shift = 0;
+        do
+        {
+            if (i == size)
+            {
+                throw std::runtime_error("ERROR: truncated cell_code\n");
+            }
+            z |= static_cast<uint64_t>(code[i] & 0x7f) << shift;
+            shift += 7;
+        } while (code[i++] & 0x80);
+        prev += (z & 1) ? -static_cast<int64_t>((z + 1) >> 1)
+                        : static_cast<int64_t>(z >> 1);
+        cells.push_back(static_cast<int>(prev));
+    }
+}
+
+/*
+ * The mesh of a step of the isosurface output in either encoding, into
+ * points[N * 3], cells[M * 3] and normals[N * 3]: get() between BeginStep()
+ * and EndStep(), decode() after EndStep().
+ */
+class MeshInput
+{
+public:
+    // prefix of the variables, lodK/ for a level of detail
+    explicit MeshInput(const std::string &prefix = "") : prefix(prefix) {}
+
+    void get(adios2::IO &io, adios2::Engine &reader,
+             std::vector<double> &points, std::vector<int> &cells,
+             std::vector<double> &normals)
+    {
+        auto varBox = io.InquireVariable<int>(prefix + "point_box");
+        compact = static_cast<bool>(varBox);
+        if (!compact)
+        {
+            auto varPoint = io.InquireVariable<double>(prefix + "point");
+            auto varCell = io.InquireVariable<int>(prefix + "cell");
+            auto varNormal = io.InquireVariable<double>(prefix + "normal");
+            if (!varPoint || !varCell || !varNormal)
+            {
+                points.clear();
+                cells.clear();
+                normals.clear();
+                return;
+            }
+            varPoint.SetSelection(
+                {{0, 0}, {varPoint.Shape()[0], varPoint.Shape()[1]}});
+            varCell.SetSelection(
+                {{0, 0}, {varCell.Shape()[0], varCell.Shape()[1]}});
+            varNormal.SetSelection(
+                {{0, 0}, {varNormal.Shape()[0], varNormal.Shape()[1]}});
+            reader.Get<double>(varPoint, points);
+            reader.Get<int>(varCell, cells);
+            reader.Get<double>(varNormal, normals);
+            return;
+        }
+
+        auto varQ = io.InquireVariable<uint16_t>(prefix + "point_q");
+        auto varOct = io.InquireVariable<int16_t>(prefix + "normal_oct");
+        auto varCode = io.InquireVariable<uint8_t>(prefix + "cell_code");
+        varBox.SetSelection({{0, 0}, varBox.Shape()});
+        varQ.SetSelection({{0, 0}, varQ.Shape()});
+        varOct.SetSelection({{0, 0}, varOct.Shape()});
+        reader.Get<int>(varBox, boxes);
+        reader.Get<uint16_t>(varQ, q);
+        reader.Get<int16_t>(varOct, oct);
+        code.clear();
+        if (varCode)
+        {
+            varCode.SetSelection({{0}, varCode.Shape()});
+            reader.Get<uint8_t>(varCode, code);
+        }
+    }
+
+    void decode(std::vector<double> &points, std::vector<int> &cells,
+                std::vector<double> &normals)
+    {
+        if (!compact)
+        {
+            return;
+        }
+        const size_t n = q.size() / 3;
+        points.resize(3 * n);
+        normals.resize(3 * n);
+        const size_t nboxes = boxes.size() / 7;
+        for (size_t b = 0; b < nboxes; ++b)
+        {
+            const int *box = boxes.data() + 7 * b;
+            const size_t first = box[0];
+            const size_t last = b + 1 < nboxes ? boxes[7 * (b + 1)] : n;
+            decode_points(q.data() + 3 * first, last - first, box + 1,
+                          points.data() + 3 * first);
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            decode_normal(oct.data() + 2 * i, normals.data() + 3 * i);
+        }
+        decode_cells(code.data(), code.size(), cells);
+    }
+
+private:
+    std::string prefix;
+    bool compact = false;
+    std::vector<int> boxes;
+    std::vector<uint16_t> q;
+    std::vector<int16_t> oct;
+    std::vector<uint8_t> code;
+};
+
+/*
+ * Parses --lod=K into the prefix of MeshInput for level K, 0 being the full
+ * mesh; returns false for other arguments
+ */
+inline bool parse_lod_option(const std::string &arg, std::string &prefix)
+{
+    if (arg.compare(0, 6, "--lod=") != 0)
+    {
+        return false;
+    }
+    const int level = std::stoi(arg.substr(6));
+    if (level < 0)
+    {
+        throw std::invalid_argument("ERROR: --lod needs a level >= 0\n");
+    }
+    prefix = level ? "lod" + std::to_string(level) + "/" : "";
+    return true;
+}
+
+#endif
@@ -0,0 +1,287 @@
+#ifndef __STEP_READER_HPP__
+#define __STEP_READER_HPP__
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+#include <mpi.h>
+
+#include "step_wait.hpp"
+
+/*
+ * Reads the steps of an input stream ahead of the analysis.
+ *
+ * A background thread begins the next step, calls the read function of the
+ * application to inquire variables, set selections and issue Gets into the
+ * buffers of a step, and ends the step, while the application processes the
+ * current one. Up to depth steps are read ahead. The step buffers are taken
+ * from a pool and reused, so the vectors of StepData keep their capacity.
+ *
+ * The engine is opened on a duplicate of comm, so its collective calls do not
+ * interfere with those of the application. Reading in the background needs
+ * MPI_THREAD_MULTIPLE; otherwise, or with depth 0, the steps are read in
+ * next() as before. Steps are begun with a StepWaiter on the duplicate.
+ *
+ * With policy.latest nothing is read ahead: the step is begun in next(), so
+ * it is the most recent one when the application asks for it.
+ *
+ * An optional exchange function runs after EndStep on the same thread, with
+ * the duplicate communicator, e.g. to share data read by other processes.
+ */
+template <class StepData>
+class StepReader
+{
+public:
+    // Called between BeginStep and EndStep with the reader IO and engine.
+    // Gets can be deferred, they are complete when next() returns the step.
+    using ReadFunction =
+        std::function<void(adios2::IO &, adios2::Engine &, StepData &)>;
+
+    // Called after EndStep with the complete step, collective over comm
+    using ExchangeFunction = std::function<void(StepData &, MPI_Comm)>;
+
+    StepReader(adios2::IO io, const std::string &name, MPI_Comm comm,
+               ReadFunction read, int depth = 1, bool lock_selections = false,
+               const WaitPolicy &policy = WaitPolicy(),
+               ExchangeFunction exchange = nullptr)
+    : io(io), read(read), exchange(exchange), depth(depth < 0 ? 0 : depth),
+      lock_selections(lock_selections), waiter(policy)
+    {
+        int provided;
+        MPI_Query_thread(&provided);
+        if (provided < MPI_THREAD_MULTIPLE || policy.latest)
+        {
+            this->depth = 0;
+        }
+
+        MPI_Comm_dup(comm, &reader_comm);
+        waiter = StepWaiter(policy, reader_comm);
+        request_latest(this->io, policy);
+        engine = this->io.Open(name, adios2::Mode::Read, reader_comm);
+
+        const int nslots = this->depth + 1;
+        for (int i = 0; i < nslots; ++i)
+        {
+            pool.emplace_back(new Slot);
+            free_slots.push_back(pool.back().get());
+        }
+        if (this->depth > 0)
+        {
+            thread = std::thread(&StepReader::run, this);
+        }
+    }
+
+    ~StepReader() { close(); }
+
+    StepReader(const StepReader &) = delete;
+    StepReader &operator=(const StepReader &) = delete;
+
+    // Steps read ahead in the background, 0 if they are read in next()
+    int prefetch_depth() const { return depth; }
+
+    // Engine step of the step returned by the last next()
+    size_t current_step() const { return current ? current->step : 0; }
+
+    // Seconds BeginStep waited for the step returned by the last next()
+    double current_wait() const { return current ? current->wait : 0.0; }
+
+    // Steps skipped before, and lag of, the step returned by the last next(),
+    // see StepWaiter
+    size_t current_skipped() const { return current ? current->skipped : 0; }
+    long current_lag() const { return current ? current->lag : 0; }
+
+    // Wait times of all steps, complete after close()
+    const StepWaiter &wait_stats() const { return waiter; }
+
+    /*
+     * The next step, or nullptr at the end of the stream. The step is valid
+     * until the next call; its buffers are then reused for a future step.
+     */
+    StepData *next()
+    {
+        if (current && current->end)
+        {
+            return nullptr;
+        }
+        if (current)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            free_slots.push_back(current);
+            current = nullptr;
+            cv_free.notify_one();
+        }
+
+        Slot *slot;
+        if (!depth)
+        {
+            slot = free_slots.front();
+            free_slots.pop_front();
+            read_step(*slot);
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv_ready.wait(lock, [this] { return !ready.empty(); });
+            slot = ready.front();
+            ready.pop_front();
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        current = slot;
+        if (slot->end)
+        {
+            // stays at the end of the stream
+            return nullptr;
+        }
+        return &slot->data;
+    }
+
+    /*
+     * Stop reading ahead and close the engine. Steps read ahead but not
+     * returned by next() are dropped.
+     */
+    void close()
+    {
+        if (closed)
+        {
+            return;
+        }
+        if (thread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            cv_free.notify_one();
+            thread.join();
+        }
+        engine.Close();
+        MPI_Comm_free(&reader_comm);
+        closed = true;
+    }
+
+private:
+    struct Slot
+    {
+        StepData data;
+        size_t step = 0;
+        double wait = 0.0;
+        size_t skipped = 0;
+        long lag = 0;
+        bool end = false;
+    };
+
+    adios2::IO io;
+    adios2::Engine engine;
+    MPI_Comm reader_comm;
+    ReadFunction read;
+    ExchangeFunction exchange;
+    int depth;
+    bool lock_selections;
+    StepWaiter waiter;
+    bool first_step = true;
+    bool closed = false;
+
+    std::vector<std::unique_ptr<Slot>> pool;
+    std::deque<Slot *> free_slots;
+    std::deque<Slot *> ready;
+    Slot *current = nullptr;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv_free;
+    std::condition_variable cv_ready;
+    bool stop = false;
+    std::exception_ptr error;
+
+    bool stopping()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stop;
+    }
+
+    // Read one step into slot, returns false at the end of the stream
+    bool read_step(Slot &slot)
+    {
+        adios2::StepStatus status =
+            waiter.begin_step(engine, [this] { return stopping(); });
+        slot.wait = waiter.last_wait();
+        if (status != adios2::StepStatus::OK)
+        {
+            slot.end = true;
+            return false;
+        }
+
+        slot.step = engine.CurrentStep();
+        slot.skipped = waiter.last_skipped_steps();
+        slot.lag = waiter.last_lag();
+        read(io, engine, slot.data);
+        if (lock_selections && first_step)
+        {
+            // the selections of the first step are used for all steps
+            engine.LockReaderSelections();
+        }
+        first_step = false;
+        engine.EndStep();
+        if (exchange)
+        {
+            exchange(slot.data, reader_comm);
+        }
+        return true;
+    }
+
+    // Background thread, reads steps into free slots until the end
+    void run()
+    {
+        while (true)
+        {
+            Slot *slot;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv_free.wait(lock,
+                             [this] { return stop || !free_slots.empty(); });
+                if (stop)
+                {
+                    return;
+                }
+                slot = free_slots.front();
+                free_slots.pop_front();
+            }
+
+            bool more;
+            try
+            {
+                more = read_step(*slot);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                error = std::current_exception();
+                more = false;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ready.push_back(slot);
+            }
+            cv_ready.notify_one();
+            if (!more)
+            {
+                return;
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,254 @@
+#ifndef __STEP_WAIT_HPP__
+#define __STEP_WAIT_HPP__
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+
+#include <adios2.h>
+#include <mpi.h>
+
+/*
+ * How to wait for the next step of a stream. Also used by the readers of
+ * heat2d/cpp and brusselator, which include this file.
+ *
+ * BeginStep blocks in the engine until the step is ready or the timeout
+ * expires, so there is no sleep between attempts and a step is taken as soon
+ * as the engine has it. The timeout starts short and grows by factor up to
+ * max_timeout while the step is not ready.
+ *
+ * With latest, older steps are skipped so that a reader which falls behind
+ * always takes the most recent step the engine has, see request_latest().
+ */
+struct WaitPolicy
+{
+    float initial_timeout = 0.1f; // seconds, first attempt for a step
+    float max_timeout = 10.0f;    // seconds, limit of the backoff
+    float factor = 2.0f;          // growth of the timeout after NotReady
+    float give_up = -1.0f;        // seconds without a step, < 0 = forever
+    bool latest = false;          // only the most recent available step
+};
+
+/*
+ * --wait=initial[:max[:factor[:give_up]]], returns false if arg is not a
+ * --wait option
+ */
+inline bool parse_wait_option(const std::string &arg, WaitPolicy &policy)
+{
+    const std::string prefix = "--wait=";
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+    {
+        return false;
+    }
+    float *fields[4] = {&policy.initial_timeout, &policy.max_timeout,
+                        &policy.factor, &policy.give_up};
+    size_t pos = prefix.size();
+    for (int i = 0; i < 4 && pos <= arg.size(); ++i)
+    {
+        size_t end = arg.find(':', pos);
+        if (end == std::string::npos)
+        {
+            end = arg.size();
+        }
+        if (end > pos)
+        {
+            *fields[i] = std::stof(arg.substr(pos, end - pos));
+        }
+        pos = end + 1;
+    }
+    if (policy.initial_timeout <= 0.0f ||
+        policy.max_timeout < policy.initial_timeout || policy.factor < 1.0f)
+    {
+        throw std::invalid_argument(
+            "ERROR: --wait needs 0 < initial <= max and factor >= 1\n");
+    }
+    return true;
+}
+
+/*
+ * --latest, returns false if arg is not a --latest option
+ */
+inline bool parse_latest_option(const std::string &arg, WaitPolicy &policy)
+{
+    if (arg != "--latest")
+    {
+        return false;
+    }
+    policy.latest = true;
+    return true;
+}
+
+/*
+ * Call before opening the reader. SST can release the older queued steps
+ * itself and give the newest one at BeginStep, so the writer is not held
+ * back by them; other engines skip steps in StepWaiter.
+ */
+inline void request_latest(adios2::IO &io, const WaitPolicy &policy)
+{
+    std::string type = io.EngineType();
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+    if (policy.latest && type == "sst")
+    {
+        io.SetParameter("AlwaysProvideLatestTimestep", "true");
+    }
+}
+
+/*
+ * Begins the steps of a reader with a WaitPolicy and records the time spent
+ * waiting for each step, the steps skipped before it and how far it is
+ * behind the newest step.
+ *
+ * BeginStep is collective, so comm must be the communicator of the reader:
+ * whether to give up, stop or skip a step is agreed on by all its processes.
+ */
+class StepWaiter
+{
+public:
+    explicit StepWaiter(const WaitPolicy &policy = WaitPolicy(),
+                        MPI_Comm comm = MPI_COMM_SELF)
+    : policy(policy), comm(comm)
+    {
+    }
+
+    /*
+     * BeginStep for reading. NotReady is only returned if the policy gives
+     * up or stop() returns true while waiting.
+     */
+    adios2::StepStatus begin_step(adios2::Engine &engine,
+                                  const std::function<bool()> &stop = nullptr)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        adios2::StepStatus status = wait(engine, t0, stop);
+        if (policy.latest)
+        {
+            // end the step without reading it while a newer one is there
+            while (status == adios2::StepStatus::OK &&
+                   newest_of_all(engine) >
+                       static_cast<long>(engine.CurrentStep()))
+            {
+                engine.EndStep();
+                status = wait(engine, t0, stop);
+            }
+        }
+
+        last = seconds_since(t0);
+        if (status == adios2::StepStatus::OK)
+        {
+            const size_t step = engine.CurrentStep();
+            last_skipped = nsteps ? step - previous - 1 : step;
+            previous = step;
+            ++nsteps;
+            total += last;
+            longest = std::max(longest, last);
+            nskipped += last_skipped;
+            const long n = newest(engine);
+            lag = n < 0 ? -1 : std::max(0L, n - static_cast<long>(step));
+        }
+        return status;
+    }
+
+    // seconds waited for the last step
+    double last_wait() const { return last; }
+    size_t steps() const { return nsteps; }
+    double total_wait() const { return total; }
+    double max_wait() const { return longest; }
+    size_t not_ready() const { return nnot_ready; }
+
+    // engine steps skipped or lost before the last step
+    size_t last_skipped_steps() const { return last_skipped; }
+    size_t skipped_steps() const { return nskipped; }
+
+    // steps the engine had after the last step when it was begun, -1 if the
+    // engine cannot tell (SST)
+    long last_lag() const { return lag; }
+
+    void print_summary(std::ostream &out, const std::string &name) const
+    {
+        out << name << " waited for " << nsteps << " steps: total " << total
+            << " s, mean " << (nsteps ? total / nsteps : 0.0) << " s, max "
+            << longest << " s, " << nnot_ready << " timeouts, " << nskipped
+            << " steps skipped" << std::endl;
+    }
+
+private:
+    WaitPolicy policy;
+    MPI_Comm comm;
+    double last = 0.0;
+    double total = 0.0;
+    double longest = 0.0;
+    size_t nsteps = 0;
+    size_t nnot_ready = 0;
+    size_t previous = 0;
+    size_t last_skipped = 0;
+    size_t nskipped = 0;
+    long lag = 0;
+
+    adios2::StepStatus wait(adios2::Engine &engine,
+                            std::chrono::steady_clock::time_point t0,
+                            const std::function<bool()> &stop)
+    {
+        float timeout = policy.initial_timeout;
+        adios2::StepStatus status;
+        while (true)
+        {
+            status = engine.BeginStep(adios2::StepMode::Read, timeout);
+            if (status != adios2::StepStatus::NotReady)
+            {
+                break;
+            }
+            ++nnot_ready;
+            const bool expired = policy.give_up >= 0.0f &&
+                                 seconds_since(t0) >= policy.give_up;
+            if (any(expired || (stop && stop())))
+            {
+                break;
+            }
+            timeout = std::min(timeout * policy.factor, policy.max_timeout);
+        }
+        return status;
+    }
+
+    // true on all processes of comm if it is true on any of them
+    bool any(bool local) const
+    {
+        int in = local ? 1 : 0;
+        int out = 0;
+        MPI_Allreduce(&in, &out, 1, MPI_INT, MPI_LOR, comm);
+        return out != 0;
+    }
+
+    // newest() of the process that knows the fewest steps
+    long newest_of_all(adios2::Engine &engine) const
+    {
+        long in = newest(engine);
+        long out = in;
+        MPI_Allreduce(&in, &out, 1, MPI_LONG, MPI_MIN, comm);
+        return out;
+    }
+
+    // last step the engine knows of, -1 if it cannot tell
+    static long newest(adios2::Engine &engine)
+    {
+        try
+        {
+            return static_cast<long>(engine.Steps()) - 1;
+        }
+        catch (std::exception &)
+        {
+            return -1;
+        }
+    }
+
+    static double seconds_since(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             t0)
+            .count();
+    }
+};
+
+#endif
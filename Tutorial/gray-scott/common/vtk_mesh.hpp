@@ -0,0 +1,104 @@
+#ifndef __VTK_MESH_HPP__
+#define __VTK_MESH_HPP__
+
+#include <vector>
+
+#include <vtkCellArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+#include <vtkVersion.h>
+
+#if VTK_MAJOR_VERSION >= 9
+#include <vtkTypeInt32Array.h>
+#endif
+
+/*
+ * A triangle mesh, points[N * 3], cells[M * 3] and normals[N * 3] (may be
+ * empty), as vtkPolyData without copying the points and normals: the arrays
+ * of the polydata point into these vectors. Read the mesh into the vectors,
+ * e.g. with MeshInput, then call poly_data(). The polydata is valid until
+ * the vectors change, so keep a VtkMesh for all steps and its buffers are
+ * reused too.
+ *
+ * With VTK 9 the cells are wrapped as well, as the connectivity of the cell
+ * array next to offsets 0, 3, 6, ... kept across steps. VTK 8 needs the
+ * legacy layout (3, a, b, c, ...), built into a buffer kept across steps.
+ */
+class VtkMesh
+{
+public:
+    std::vector<double> points;
+    std::vector<int> cells;
+    std::vector<double> normals;
+
+    vtkSmartPointer<vtkPolyData> poly_data()
+    {
+        const vtkIdType nPoints = points.size() / 3;
+        const vtkIdType nCells = cells.size() / 3;
+
+        // new VTK objects are cheap and drop the caches of the last step
+        // (links, cell types); only their data is reused
+        auto pointArray = vtkSmartPointer<vtkDoubleArray>::New();
+        pointArray->SetNumberOfComponents(3);
+        pointArray->SetArray(points.data(), nPoints * 3, 1);
+        auto vtkpoints = vtkSmartPointer<vtkPoints>::New();
+        vtkpoints->SetData(pointArray);
+
+        auto polys = vtkSmartPointer<vtkCellArray>::New();
+#if VTK_MAJOR_VERSION >= 9
+        if (offsets.size() < static_cast<size_t>(nCells + 1))
+        {
+            const size_t first = offsets.size();
+            offsets.resize(nCells + 1);
+            for (size_t i = first; i < offsets.size(); i++)
+            {
+                offsets[i] = static_cast<vtkTypeInt32>(i * 3);
+            }
+        }
+        auto offsetArray = vtkSmartPointer<vtkTypeInt32Array>::New();
+        offsetArray->SetArray(offsets.data(), nCells + 1, 1);
+        auto connectivity = vtkSmartPointer<vtkTypeInt32Array>::New();
+        connectivity->SetArray(cells.data(), nCells * 3, 1);
+        polys->SetData(offsetArray, connectivity);
+#else
+        legacy.resize(nCells * 4);
+        for (vtkIdType i = 0; i < nCells; i++)
+        {
+            legacy[i * 4] = 3;
+            legacy[i * 4 + 1] = cells[i * 3];
+            legacy[i * 4 + 2] = cells[i * 3 + 1];
+            legacy[i * 4 + 3] = cells[i * 3 + 2];
+        }
+        auto cellArray = vtkSmartPointer<vtkIdTypeArray>::New();
+        cellArray->SetArray(legacy.data(), nCells * 4, 1);
+        polys->SetCells(nCells, cellArray);
+#endif
+
+        auto polyData = vtkSmartPointer<vtkPolyData>::New();
+        polyData->SetPoints(vtkpoints);
+        polyData->SetPolys(polys);
+
+        if (normals.size() == points.size())
+        {
+            auto normalArray = vtkSmartPointer<vtkDoubleArray>::New();
+            normalArray->SetNumberOfComponents(3);
+            normalArray->SetArray(normals.data(), nPoints * 3, 1);
+            polyData->GetPointData()->SetNormals(normalArray);
+        }
+
+        return polyData;
+    }
+
+private:
+#if VTK_MAJOR_VERSION >= 9
+    std::vector<vtkTypeInt32> offsets;
+#else
+    std::vector<vtkIdType> legacy;
+#endif
+};
+
+#endif
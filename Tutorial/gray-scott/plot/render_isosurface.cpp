@@ -7,17 +7,16 @@
  */
 
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <adios2.h>
 
 #include <vtkActor.h>
 #include <vtkAutoInit.h>
 #include <vtkCallbackCommand.h>
-#include <vtkCellArray.h>
-#include <vtkDoubleArray.h>
 #include <vtkInteractorStyleSwitch.h>
-#include <vtkPointData.h>
-#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
 #include <vtkProperty.h>
@@ -27,6 +26,10 @@
 #include <vtkRenderer.h>
 #include <vtkSmartPointer.h>
 
+#include "../common/mesh_encoding.hpp"
+#include "../common/step_wait.hpp"
+#include "../common/vtk_mesh.hpp"
+
 VTK_MODULE_INIT(vtkRenderingOpenGL2);
 VTK_MODULE_INIT(vtkInteractionStyle);
 VTK_MODULE_INIT(vtkRenderingFreeType);
@@ -37,95 +40,45 @@ typedef struct
     vtkPolyDataMapper *mapper;
     adios2::IO *inIO;
     adios2::Engine *reader;
+    StepWaiter *waiter;
+    std::string lod;
+    VtkMesh *vtkMesh; // the mapper renders from its buffers
 } Context;
 
-vtkSmartPointer<vtkPolyData> read_mesh(const std::vector<double> &bufPoints,
-                                       const std::vector<int> &bufCells,
-                                       const std::vector<double> &bufNormals)
-{
-    int nPoints = bufPoints.size() / 3;
-    int nCells = bufCells.size() / 3;
-
-    auto points = vtkSmartPointer<vtkPoints>::New();
-    points->SetNumberOfPoints(nPoints);
-    for (vtkIdType i = 0; i < nPoints; i++)
-    {
-        points->SetPoint(i, &bufPoints[i * 3]);
-    }
-
-    auto polys = vtkSmartPointer<vtkCellArray>::New();
-    for (vtkIdType i = 0; i < nCells; i++)
-    {
-        vtkIdType a = bufCells[i * 3 + 0];
-        vtkIdType b = bufCells[i * 3 + 1];
-        vtkIdType c = bufCells[i * 3 + 2];
-
-        polys->InsertNextCell(3);
-        polys->InsertCellPoint(a);
-        polys->InsertCellPoint(b);
-        polys->InsertCellPoint(c);
-    }
-
-    auto normals = vtkSmartPointer<vtkDoubleArray>::New();
-    normals->SetNumberOfComponents(3);
-    for (vtkIdType i = 0; i < nPoints; i++)
-    {
-        normals->InsertNextTuple(&bufNormals[i * 3]);
-    }
-
-    auto polyData = vtkSmartPointer<vtkPolyData>::New();
-    polyData->SetPoints(points);
-    polyData->SetPolys(polys);
-    polyData->GetPointData()->SetNormals(normals);
-
-    return polyData;
-}
-
 void timer_func(vtkObject *object, unsigned long eid, void *clientdata,
                 void *calldata)
 {
     Context *context = static_cast<Context *>(clientdata);
 
-    std::vector<double> points;
-    std::vector<int> cells;
-    std::vector<double> normals;
+    VtkMesh &vtkMesh = *context->vtkMesh;
+    MeshInput mesh(context->lod);
     int step;
 
-    adios2::StepStatus status = context->reader->BeginStep();
+    adios2::StepStatus status = context->waiter->begin_step(*context->reader);
 
     if (status != adios2::StepStatus::OK)
     {
         return;
     }
 
-    auto varPoint = context->inIO->InquireVariable<double>("point");
-    auto varCell = context->inIO->InquireVariable<int>("cell");
-    auto varNormal = context->inIO->InquireVariable<double>("normal");
     auto varStep = context->inIO->InquireVariable<int>("step");
 
-    if (varPoint.Shape().size() > 0 || varCell.Shape().size() > 0)
-    {
-        varPoint.SetSelection(
-            {{0, 0}, {varPoint.Shape()[0], varPoint.Shape()[1]}});
-        varCell.SetSelection(
-            {{0, 0}, {varCell.Shape()[0], varCell.Shape()[1]}});
-        varNormal.SetSelection(
-            {{0, 0}, {varNormal.Shape()[0], varNormal.Shape()[1]}});
-
-        context->reader->Get<double>(varPoint, points);
-        context->reader->Get<int>(varCell, cells);
-        context->reader->Get<double>(varNormal, normals);
-    }
-
+    mesh.get(*context->inIO, *context->reader, vtkMesh.points, vtkMesh.cells,
+             vtkMesh.normals);
     context->reader->Get<int>(varStep, &step);
 
     context->reader->EndStep();
+    mesh.decode(vtkMesh.points, vtkMesh.cells, vtkMesh.normals);
 
-    std::cout << "render_isosurface at step " << step << std::endl;
-
-    vtkSmartPointer<vtkPolyData> polyData = read_mesh(points, cells, normals);
+    std::cout << "render_isosurface at step " << step << ", skipped "
+              << context->waiter->last_skipped_steps() << " steps";
+    if (context->waiter->last_lag() >= 0)
+    {
+        std::cout << ", " << context->waiter->last_lag() << " steps behind";
+    }
+    std::cout << std::endl;
 
-    context->mapper->SetInputData(polyData);
+    context->mapper->SetInputData(vtkMesh.poly_data());
     context->renderView->ResetCamera();
     context->renderView->Render();
 }
@@ -145,16 +98,55 @@ int main(int argc, char *argv[])
     MPI_Comm_rank(comm, &rank);
     MPI_Comm_size(comm, &procs);
 
-    if (argc < 2)
+    // --latest, --wait=... and --lod=K can be anywhere, the rest are
+    // positional
+    WaitPolicy policy;
+    bool wait_set = false;
+    std::string lod;
+    std::vector<std::string> args;
+    try
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            if (parse_wait_option(argv[i], policy))
+            {
+                wait_set = true;
+            }
+            else if (!parse_latest_option(argv[i], policy) &&
+                     !parse_lod_option(argv[i], lod))
+            {
+                args.push_back(argv[i]);
+            }
+        }
+    }
+    catch (std::exception &e)
+    {
+        if (rank == 0)
+        {
+            std::cerr << e.what() << std::endl;
+        }
+        MPI_Abort(MPI_COMM_WORLD, -1);
+    }
+
+    if (args.size() < 1)
     {
         if (rank == 0)
         {
             std::cerr << "Too few arguments" << std::endl;
-            std::cout << "Usage: render_isosurface input" << std::endl;
+            std::cout << "Usage: render_isosurface input [--latest] "
+                         "[--wait=I[:M[:F[:G]]]] [--lod=K]"
+                      << std::endl;
         }
         MPI_Abort(MPI_COMM_WORLD, -1);
     }
 
+    // with --latest, the timer only polls for a newer step so the window
+    // stays responsive
+    if (policy.latest && !wait_set)
+    {
+        policy.give_up = 0.0f;
+    }
+
     if (procs != 1)
     {
         if (rank == 0)
@@ -165,11 +157,12 @@ int main(int argc, char *argv[])
         MPI_Abort(MPI_COMM_WORLD, -1);
     }
 
-    const std::string input_fname(argv[1]);
+    const std::string input_fname(args[0]);
 
     adios2::ADIOS adios("adios2.xml", comm);
 
     adios2::IO inIO = adios.DeclareIO("IsosurfaceOutput");
+    request_latest(inIO, policy);
     adios2::Engine reader = inIO.Open(input_fname, adios2::Mode::Read);
 
     auto mapper = vtkSmartPointer<vtkPolyDataMapper>::New();
@@ -189,11 +182,17 @@ int main(int argc, char *argv[])
     interactor->SetInteractorStyle(style);
     interactor->CreateRepeatingTimer(100);
 
+    StepWaiter waiter(policy, comm);
+    VtkMesh vtkMesh;
+
     Context context = {
         .renderView = renderView,
         .mapper = mapper,
         .inIO = &inIO,
         .reader = &reader,
+        .waiter = &waiter,
+        .lod = lod,
+        .vtkMesh = &vtkMesh,
     };
 
     auto timerCallback = vtkSmartPointer<vtkCallbackCommand>::New();
@@ -205,4 +204,5 @@ int main(int argc, char *argv[])
     interactor->Start();
 
     reader.Close();
+    waiter.print_summary(std::cout, "render_isosurface");
 }
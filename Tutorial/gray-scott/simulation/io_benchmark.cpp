@@ -0,0 +1,285 @@
+/*
+ * I/O benchmark driver for the Gray-Scott simulation.
+ *
+ * Runs the same simulation configuration once with each of the given output
+ * backends and reports, as seen by the simulation, the compute time, the time
+ * spent in the writer, the per-step write bandwidth and the end-to-end time.
+ * For an asynchronous backend it also reports how much of the I/O time of its
+ * synchronous counterpart is overlapped with the computation.
+ *
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <adios2.h>
+#include <mpi.h>
+
+#include "gray-scott.h"
+#include "settings.h"
+#include "writer.h"
+
+struct RunStats
+{
+    std::string backend;
+    int nsteps;     // output steps
+    double mb;      // size of all output steps in MB
+    double open;    // seconds, slowest process
+    double compute;
+    double write;
+    double close;
+    double total;   // end-to-end, open to close
+    double bw_min;  // write bandwidth of the slowest/fastest step in MB/s
+    double bw_max;
+};
+
+void printUsage()
+{
+    std::cout
+        << "Usage: gray-scott-iobench settings.json [backend ...]\n"
+        << "  settings.json: simulation settings, output is used as the "
+           "base name\n"
+        << "  backend:       none, mpiio, mpiio_async, adios, adios_async\n"
+        << "                 default = all of them\n\n";
+}
+
+/* gs.bp -> gs-<backend>.bp or gs-<backend>.gs */
+std::string output_name(const std::string &output, const std::string &backend)
+{
+    std::string stem = output;
+    size_t dot = stem.find_last_of('.');
+    size_t slash = stem.find_last_of('/');
+    if (dot != std::string::npos && (slash == std::string::npos || dot > slash))
+    {
+        stem.resize(dot);
+    }
+    bool mpiio = (backend.compare(0, 5, "mpiio") == 0);
+    return stem + "-" + backend + (mpiio ? ".gs" : ".bp");
+}
+
+RunStats run(const std::string &backend, const Settings &settings,
+             adios2::IO io, const adios2::Params &params, MPI_Comm comm)
+{
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+
+    /* the IO is reused by all ADIOS runs, start from the configured state */
+    io.RemoveAllVariables();
+    io.RemoveAllAttributes();
+    io.ClearParameters();
+    io.SetParameters(params);
+
+    GrayScott sim(settings, comm);
+    sim.init();
+
+    std::unique_ptr<Writer> writer =
+        make_writer(backend, settings, sim, io, comm);
+
+    MPI_Barrier(comm);
+    double t_start = MPI_Wtime();
+    writer->open(output_name(settings.output, backend));
+    double t_open = MPI_Wtime() - t_start;
+
+    if (!rank)
+    {
+        writer->print_settings();
+    }
+
+    double t_compute = 0.0;
+    double t_write = 0.0;
+    std::vector<double> step_times;
+    for (int i = 0; i < settings.steps;)
+    {
+        double t0 = MPI_Wtime();
+        for (int j = 0; j < settings.plotgap; j++)
+        {
+            sim.iterate();
+            i++;
+        }
+        double t1 = MPI_Wtime();
+        writer->write(i, sim);
+        double t2 = MPI_Wtime();
+
+        t_compute += t1 - t0;
+        t_write += t2 - t1;
+        step_times.push_back(t2 - t1);
+    }
+
+    double t3 = MPI_Wtime();
+    writer->close();
+    double t_close = MPI_Wtime() - t3;
+    MPI_Barrier(comm);
+    double t_total = MPI_Wtime() - t_start;
+
+    /* slowest process counts, per step and overall */
+    RunStats stats;
+    stats.backend = backend;
+    stats.nsteps = static_cast<int>(step_times.size());
+    std::vector<double> step_max(step_times.size());
+    MPI_Reduce(step_times.data(), step_max.data(), stats.nsteps, MPI_DOUBLE,
+               MPI_MAX, 0, comm);
+    double t[5] = {t_open, t_compute, t_write, t_close, t_total}, tmax[5];
+    MPI_Reduce(t, tmax, 5, MPI_DOUBLE, MPI_MAX, 0, comm);
+
+    /* U, V and step of one output step */
+    double mb_step =
+        (backend == "none")
+            ? 0.0
+            : (2.0 * settings.L * settings.L * settings.L * sizeof(double) +
+               sizeof(int)) /
+                  1048576.0;
+    stats.mb = mb_step * stats.nsteps;
+    stats.open = tmax[0];
+    stats.compute = tmax[1];
+    stats.write = tmax[2];
+    stats.close = tmax[3];
+    stats.total = tmax[4];
+    stats.bw_min = 0.0;
+    stats.bw_max = 0.0;
+    if (!rank && stats.nsteps)
+    {
+        auto minmax = std::minmax_element(step_max.begin(), step_max.end());
+        stats.bw_min = mb_step / *minmax.second;
+        stats.bw_max = mb_step / *minmax.first;
+    }
+    return stats;
+}
+
+void print_results(const std::vector<RunStats> &results)
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << std::left << std::setw(13) << "backend" << std::right
+              << std::setw(7) << "steps" << std::setw(11) << "MB"
+              << std::setw(11) << "open[s]" << std::setw(12) << "compute[s]"
+              << std::setw(11) << "write[s]" << std::setw(11) << "close[s]"
+              << std::setw(11) << "total[s]" << std::setw(11) << "MB/s"
+              << std::setw(24) << "step MB/s min/max" << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto &r : results)
+    {
+        double io = r.open + r.write + r.close;
+        std::ostringstream bw;
+        bw << std::fixed << std::setprecision(1) << r.bw_min << " / "
+           << r.bw_max;
+        std::cout << std::left << std::setw(13) << r.backend << std::right
+                  << std::setw(7) << r.nsteps << std::setw(11) << r.mb
+                  << std::setw(11) << r.open << std::setw(12) << r.compute
+                  << std::setw(11) << r.write << std::setw(11) << r.close
+                  << std::setw(11) << r.total << std::setw(11)
+                  << (io > 0.0 ? r.mb / io : 0.0) << std::setw(24) << bw.str()
+                  << std::endl;
+    }
+
+    /*
+     * Overlap of an asynchronous backend: the part of the I/O time of the
+     * synchronous counterpart that the simulation does not see anymore.
+     */
+    for (const auto &async : results)
+    {
+        size_t pos = async.backend.find("_async");
+        if (pos == std::string::npos)
+        {
+            continue;
+        }
+        std::string sync_name = async.backend.substr(0, pos);
+        for (const auto &sync : results)
+        {
+            if (sync.backend != sync_name)
+            {
+                continue;
+            }
+            double io_sync = sync.open + sync.write + sync.close;
+            double io_async = async.open + async.write + async.close;
+            std::cout << async.backend << " vs " << sync.backend
+                      << ": I/O time " << io_sync << " s -> " << io_async
+                      << " s, overlap " << std::setprecision(1)
+                      << 100.0 * (1.0 - io_async / io_sync)
+                      << std::setprecision(3)
+                      << "%, compute " << sync.compute << " s -> "
+                      << async.compute << " s, end-to-end " << sync.total
+                      << " s -> " << async.total << " s" << std::endl;
+        }
+    }
+    std::cout << "========================================" << std::endl;
+}
+
+/*
+ * MAIN
+ */
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    int rank, procs, wrank;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &wrank);
+
+    const unsigned int color = 1;
+    MPI_Comm comm;
+    MPI_Comm_split(MPI_COMM_WORLD, color, wrank, &comm);
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &procs);
+
+    if (argc < 2)
+    {
+        if (rank == 0)
+        {
+            std::cerr << "Too few arguments" << std::endl;
+            printUsage();
+        }
+        MPI_Abort(MPI_COMM_WORLD, -1);
+    }
+
+    Settings settings = Settings::from_json(argv[1]);
+
+    std::vector<std::string> backends;
+    for (int i = 2; i < argc; ++i)
+    {
+        backends.push_back(argv[i]);
+    }
+    if (backends.empty())
+    {
+        backends = {"none", "mpiio", "mpiio_async", "adios", "adios_async"};
+    }
+
+    adios2::ADIOS adios(settings.adios_config, comm);
+    adios2::IO io = adios.DeclareIO("SimulationOutput");
+    const adios2::Params params = io.Parameters();
+
+    if (rank == 0)
+    {
+        std::cout << "========================================" << std::endl;
+        std::cout << "grid:             " << settings.L << "x" << settings.L
+                  << "x" << settings.L << std::endl;
+        std::cout << "steps:            " << settings.steps << std::endl;
+        std::cout << "plotgap:          " << settings.plotgap << std::endl;
+        std::cout << "processes:        " << procs << std::endl;
+        std::cout << "adios_config:     " << settings.adios_config
+                  << std::endl;
+        std::cout << "========================================" << std::endl;
+    }
+
+    std::vector<RunStats> results;
+    for (const auto &backend : backends)
+    {
+        if (rank == 0)
+        {
+            std::cout << "Benchmark backend " << backend << " writing "
+                      << output_name(settings.output, backend) << std::endl;
+        }
+        results.push_back(run(backend, settings, io, params, comm));
+    }
+
+    if (rank == 0)
+    {
+        print_results(results);
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,356 @@
+/*
+ * I/O emulation of the Gray-Scott simulation.
+ *
+ * Replays the I/O pattern recorded by gray-scott with "trace" in
+ * settings.json: the same variables and output steps are written with ADIOS
+ * from synthetic buffers, waiting the recorded computation time (or a
+ * fraction of it) between the steps, without running the simulation.
+ * The arrays are decomposed again if the number of processes differs from
+ * the recorded run, keeping the global size (strong scaling) or the size of
+ * a block (weak scaling).
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <adios2.h>
+#include <mpi.h>
+
+#include "json.hpp"
+
+/*
+ * Print info to the user on how to invoke the application
+ */
+void printUsage()
+{
+    std::cout
+        << "Usage: gray-scott-replay trace output [speedup] [scaling] "
+           "[adios_config]\n"
+        << "  trace:   I/O trace recorded by gray-scott (\"trace\" in "
+           "settings.json)\n"
+        << "  output:  Name of the output file/stream\n"
+        << "  speedup: Computation time between steps is divided by this, "
+           "default = 1,\n"
+        << "           0 = no computation time\n"
+        << "  scaling: strong (keep global size) or weak (keep block size), "
+           "default = strong\n"
+        << "  adios_config: ADIOS2 XML file name, IO SimulationOutput is "
+           "used, default = adios2.xml\n\n";
+}
+
+struct ReplayVariable
+{
+    std::string name;
+    std::string type;
+    adios2::Dims shape, start, count;
+    adios2::Variable<double> var_double;
+    adios2::Variable<int32_t> var_int;
+    std::vector<double> data;
+};
+
+/*
+ * Block of this rank in a block decomposition of shape over dims processes,
+ * the first processes in a dimension get one more element of the remainder
+ */
+void decompose(const adios2::Dims &shape, const std::vector<int> &dims,
+               int rank, adios2::Dims &start, adios2::Dims &count)
+{
+    const size_t ndim = shape.size();
+    start.resize(ndim);
+    count.resize(ndim);
+    for (size_t d = ndim; d-- > 0;)
+    {
+        size_t p = static_cast<size_t>(rank % dims[d]);
+        rank /= dims[d];
+        size_t n = shape[d] / dims[d];
+        size_t rem = shape[d] % dims[d];
+        count[d] = n + (p < rem ? 1 : 0);
+        start[d] = p * n + std::min(p, rem);
+    }
+}
+
+/*
+ * MAIN
+ */
+int main(int argc, char *argv[])
+{
+    MPI_Init(&argc, &argv);
+    int rank, comm_size, wrank;
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &wrank);
+
+    const unsigned int color = 1;
+    MPI_Comm comm;
+    MPI_Comm_split(MPI_COMM_WORLD, color, wrank, &comm);
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &comm_size);
+
+    if (argc < 3)
+    {
+        std::cout << "Not enough arguments\n";
+        if (rank == 0)
+            printUsage();
+        MPI_Finalize();
+        return 0;
+    }
+
+    std::string trace_filename = argv[1];
+    std::string out_filename = argv[2];
+    double speedup = 1.0;
+    bool weak = false;
+    std::string adios_config = "adios2.xml";
+
+    if (argc >= 4)
+    {
+        speedup = std::stod(argv[3]);
+    }
+    if (argc >= 5)
+    {
+        std::string value = argv[4];
+        if (value == "weak")
+            weak = true;
+        else if (value != "strong")
+            throw std::invalid_argument("ERROR: scaling must be strong or "
+                                        "weak\n");
+    }
+    if (argc >= 6)
+    {
+        adios_config = argv[5];
+    }
+
+    nlohmann::json trace;
+    std::ifstream ifs(trace_filename);
+    if (!ifs)
+    {
+        throw std::invalid_argument("ERROR: cannot open I/O trace " +
+                                    trace_filename + "\n");
+    }
+    ifs >> trace;
+
+    const int trace_nprocs = trace.at("nprocs").get<int>();
+    const std::vector<int> steps =
+        trace.at("steps").at("step").get<std::vector<int>>();
+    const std::vector<double> compute =
+        trace.at("steps").at("compute").get<std::vector<double>>();
+    const std::vector<double> recorded_write =
+        trace.at("steps").at("write").get<std::vector<double>>();
+
+    // the recorded blocks are used as is with the same number of processes
+    const bool redecompose = (comm_size != trace_nprocs) || weak;
+
+    adios2::ADIOS ad(adios_config, comm);
+    adios2::IO io = ad.DeclareIO("SimulationOutput");
+
+    std::vector<ReplayVariable> vars;
+    size_t bytes_per_step = 0; // of this process
+    for (const auto &v : trace.at("variables"))
+    {
+        ReplayVariable rv;
+        rv.name = v.at("name").get<std::string>();
+        rv.type = v.at("type").get<std::string>();
+        if (v.count("shape"))
+        {
+            rv.shape = v.at("shape").get<adios2::Dims>();
+            if (!redecompose)
+            {
+                rv.start = v.at("start").at(rank).get<adios2::Dims>();
+                rv.count = v.at("count").at(rank).get<adios2::Dims>();
+            }
+            else
+            {
+                std::vector<int> dims(rv.shape.size(), 0);
+                MPI_Dims_create(comm_size, static_cast<int>(dims.size()),
+                                dims.data());
+                if (weak)
+                {
+                    // block size of the first recorded process
+                    adios2::Dims block =
+                        v.at("count").at(0).get<adios2::Dims>();
+                    for (size_t d = 0; d < rv.shape.size(); ++d)
+                    {
+                        rv.shape[d] = block[d] * dims[d];
+                    }
+                }
+                decompose(rv.shape, dims, rank, rv.start, rv.count);
+            }
+        }
+
+        if (rv.type == "double")
+        {
+            rv.var_double = io.DefineVariable<double>(rv.name, rv.shape,
+                                                      rv.start, rv.count);
+            size_t n = 1;
+            for (auto c : rv.count)
+            {
+                n *= c;
+            }
+            // synthetic content, varying by process and position
+            rv.data.resize(n);
+            for (size_t i = 0; i < n; ++i)
+            {
+                rv.data[i] = rank + static_cast<double>(i % 1024) / 1024.0;
+            }
+            bytes_per_step += n * sizeof(double);
+        }
+        else if (rv.type == "int32_t")
+        {
+            rv.var_int = io.DefineVariable<int32_t>(rv.name);
+            bytes_per_step += sizeof(int32_t);
+        }
+        else
+        {
+            throw std::invalid_argument("ERROR: type " + rv.type +
+                                        " of variable " + rv.name +
+                                        " is not supported in the trace\n");
+        }
+        vars.push_back(std::move(rv));
+    }
+
+    // attributes of the backend, none in older traces
+    if (trace.count("attributes"))
+    {
+        for (const auto &a : trace.at("attributes"))
+        {
+            const std::string name = a.at("name").get<std::string>();
+            const std::string type = a.at("type").get<std::string>();
+            if (type == "double")
+            {
+                io.DefineAttribute<double>(name, a.at("value").get<double>());
+            }
+            else if (type == "string")
+            {
+                io.DefineAttribute<std::string>(
+                    name, a.at("value").get<std::string>());
+            }
+            else
+            {
+                throw std::invalid_argument("ERROR: type " + type +
+                                            " of attribute " + name +
+                                            " is not supported in the "
+                                            "trace\n");
+            }
+        }
+    }
+    const size_t ncheckpoints =
+        trace.count("checkpoints")
+            ? trace.at("checkpoints").at("step").size()
+            : 0;
+
+    if (!rank)
+    {
+        std::cout << "Replay " << steps.size() << " output steps of "
+                  << trace_filename << " recorded on " << trace_nprocs
+                  << " processes, on " << comm_size << " processes"
+                  << (redecompose ? (weak ? " (weak scaling)"
+                                          : " (strong scaling)")
+                                  : "")
+                  << std::endl;
+        std::cout << "Replay writes data using engine type:              "
+                  << io.EngineType() << std::endl;
+        for (const auto &rv : vars)
+        {
+            std::cout << "  " << rv.type << " " << rv.name;
+            for (size_t d = 0; d < rv.shape.size(); ++d)
+            {
+                std::cout << (d ? "x" : " {") << rv.shape[d];
+            }
+            std::cout << (rv.shape.empty() ? "" : "}") << std::endl;
+        }
+        if (ncheckpoints)
+        {
+            std::cout << "  " << ncheckpoints
+                      << " recorded checkpoints are not replayed"
+                      << std::endl;
+        }
+    }
+
+    MPI_Barrier(comm);
+    double t_start = MPI_Wtime();
+    adios2::Engine writer = io.Open(out_filename, adios2::Mode::Write);
+    double t_open = MPI_Wtime() - t_start;
+
+    double t_write = 0.0;
+    for (size_t s = 0; s < steps.size(); ++s)
+    {
+        // stand-in for the computation of the simulation
+        if (speedup > 0.0)
+        {
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>(compute[s] / speedup));
+        }
+
+        double t0 = MPI_Wtime();
+        writer.BeginStep();
+        for (auto &rv : vars)
+        {
+            if (rv.type == "double")
+            {
+                writer.Put<double>(rv.var_double, rv.data.data());
+            }
+            else
+            {
+                writer.Put<int32_t>(rv.var_int, steps[s]);
+            }
+        }
+        writer.EndStep();
+        double dt = MPI_Wtime() - t0;
+        t_write += dt;
+
+        double dtmax;
+        MPI_Reduce(&dt, &dtmax, 1, MPI_DOUBLE, MPI_MAX, 0, comm);
+        if (!rank)
+        {
+            std::cout << "Replay step " << s << " (sim step " << steps[s]
+                      << "): write " << dtmax << " s, recorded "
+                      << recorded_write[s] << " s" << std::endl;
+        }
+    }
+
+    double t0 = MPI_Wtime();
+    writer.Close();
+    double t_close = MPI_Wtime() - t0;
+    MPI_Barrier(comm);
+    double t_total = MPI_Wtime() - t_start;
+
+    // summary, slowest process counts
+    unsigned long long bytes = bytes_per_step, total_bytes;
+    MPI_Reduce(&bytes, &total_bytes, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0,
+               comm);
+    double t[4] = {t_open, t_write, t_close, t_total}, tmax[4];
+    MPI_Reduce(t, tmax, 4, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (!rank)
+    {
+        double recorded = trace.at("open").get<double>() +
+                          trace.at("close").get<double>();
+        for (auto w : recorded_write)
+        {
+            recorded += w;
+        }
+        double mb = steps.size() * total_bytes / 1048576.0;
+        double io_time = tmax[0] + tmax[1] + tmax[2];
+        std::cout << "========================================" << std::endl;
+        std::cout << "Replay output:    " << steps.size() << " steps, " << mb
+                  << " MB" << std::endl;
+        std::cout << "open time:        " << tmax[0] << " s" << std::endl;
+        std::cout << "write time:       " << tmax[1] << " s" << std::endl;
+        std::cout << "close time:       " << tmax[2] << " s" << std::endl;
+        std::cout << "I/O bandwidth:    " << mb / io_time << " MB/s"
+                  << std::endl;
+        std::cout << "I/O time:         " << io_time << " s, recorded "
+                  << recorded << " s" << std::endl;
+        std::cout << "end-to-end time:  " << tmax[3] << " s" << std::endl;
+        std::cout << "========================================" << std::endl;
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <vector>
 
@@ -8,14 +9,9 @@
 
 #include "../common/timer.hpp"
 #include "gray-scott.h"
+#include "trace_writer.h"
 #include "writer.h"
 
-void print_io_settings(const adios2::IO &io)
-{
-    std::cout << "Simulation writes data using engine type:              "
-              << io.EngineType() << std::endl;
-}
-
 void print_settings(const Settings &s)
 {
     std::cout << "grid:             " << s.L << "x" << s.L << "x" << s.L
@@ -29,6 +25,7 @@ void print_settings(const Settings &s)
     std::cout << "Dv:               " << s.Dv << std::endl;
     std::cout << "noise:            " << s.noise << std::endl;
     std::cout << "output:           " << s.output << std::endl;
+    std::cout << "writer:           " << s.writer << std::endl;
     std::cout << "adios_config:     " << s.adios_config << std::endl;
 }
 
@@ -73,14 +70,21 @@ int main(int argc, char **argv)
     adios2::IO io_main = adios.DeclareIO("SimulationOutput");
     adios2::IO io_ckpt = adios.DeclareIO("SimulationCheckpoint");
 
-    Writer writer_main(settings, sim, io_main);
-    Writer writer_ckpt(settings, sim, io_ckpt);
+    std::unique_ptr<Writer> writer_main =
+        make_writer(settings.writer, settings, sim, io_main, comm);
+    TraceWriter *trace = nullptr;
+    if (!settings.trace.empty())
+    {
+        trace = new TraceWriter(std::move(writer_main), settings, sim, comm);
+        writer_main.reset(trace);
+    }
+    ADIOSWriter writer_ckpt(settings, sim, io_ckpt);
 
-    writer_main.open(settings.output);
+    writer_main->open(settings.output);
 
     if (rank == 0)
     {
-        print_io_settings(io_main);
+        writer_main->print_settings();
         std::cout << "========================================" << std::endl;
         print_settings(settings);
         print_simulator_settings(sim);
@@ -107,11 +111,16 @@ int main(int argc, char **argv)
         timer_compute.start();
 #endif
 
+        const double t_compute = MPI_Wtime();
         for (int j = 0; j < settings.plotgap; j++)
         {
             sim.iterate();
             i++;
         }
+        if (trace)
+        {
+            trace->computed(MPI_Wtime() - t_compute);
+        }
 
 #ifdef ENABLE_TIMERS
         double time_compute = timer_compute.stop();
@@ -126,14 +135,19 @@ int main(int argc, char **argv)
                       << std::endl;
         }
 
-        writer_main.write(i, sim);
+        writer_main->write(i, sim);
 
         if (settings.checkpoint &&
             i % (settings.plotgap * settings.checkpoint_freq) == 0)
         {
+            const double t_ckpt = MPI_Wtime();
             writer_ckpt.open(settings.checkpoint_output);
             writer_ckpt.write(i, sim);
             writer_ckpt.close();
+            if (trace)
+            {
+                trace->checkpoint(i, MPI_Wtime() - t_ckpt);
+            }
         }
 
 #ifdef ENABLE_TIMERS
@@ -146,7 +160,7 @@ int main(int argc, char **argv)
 #endif
     }
 
-    writer_main.close();
+    writer_main->close();
 
 #ifdef ENABLE_TIMERS
     log << "total\t" << timer_total.elapsed() << "\t" << timer_compute.elapsed()
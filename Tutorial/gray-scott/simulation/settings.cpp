@@ -21,7 +21,12 @@ void to_json(nlohmann::json &j, const Settings &s)
                        {"adios_config", s.adios_config},
                        {"adios_span", s.adios_span},
                        {"adios_memory_selection", s.adios_memory_selection},
-                       {"mesh_type", s.mesh_type}};
+                       {"mesh_type", s.mesh_type},
+                       {"writer", s.writer},
+                       {"mpiio_hints", s.mpiio_hints},
+                       {"mpiio_subfiling", s.mpiio_subfiling},
+                       {"mpiio_ranks_per_subfile", s.mpiio_ranks_per_subfile},
+                       {"trace", s.trace}};
 }
 
 void from_json(const nlohmann::json &j, Settings &s)
@@ -43,6 +48,35 @@ void from_json(const nlohmann::json &j, Settings &s)
     j.at("adios_span").get_to(s.adios_span);
     j.at("adios_memory_selection").get_to(s.adios_memory_selection);
     j.at("mesh_type").get_to(s.mesh_type);
+
+    // optional output backend and MPI-IO settings, hint values can be given
+    // as numbers too
+    if (j.count("writer"))
+    {
+        j.at("writer").get_to(s.writer);
+    }
+    if (j.count("mpiio_hints"))
+    {
+        for (auto it = j.at("mpiio_hints").begin();
+             it != j.at("mpiio_hints").end(); ++it)
+        {
+            s.mpiio_hints[it.key()] = it.value().is_string()
+                                          ? it.value().get<std::string>()
+                                          : it.value().dump();
+        }
+    }
+    if (j.count("mpiio_subfiling"))
+    {
+        j.at("mpiio_subfiling").get_to(s.mpiio_subfiling);
+    }
+    if (j.count("mpiio_ranks_per_subfile"))
+    {
+        j.at("mpiio_ranks_per_subfile").get_to(s.mpiio_ranks_per_subfile);
+    }
+    if (j.count("trace"))
+    {
+        j.at("trace").get_to(s.trace);
+    }
 }
 
 Settings::Settings()
@@ -64,6 +98,9 @@ Settings::Settings()
     adios_span = false;
     adios_memory_selection = false;
     mesh_type = "image";
+    writer = "adios";
+    mpiio_subfiling = "none";
+    mpiio_ranks_per_subfile = 8;
 }
 
 Settings Settings::from_json(const std::string &fname)
@@ -1,6 +1,7 @@
 #ifndef __SETTINGS_H__
 #define __SETTINGS_H__
 
+#include <map>
 #include <string>
 
 struct Settings
@@ -22,6 +23,16 @@ struct Settings
     bool adios_span;
     bool adios_memory_selection;
     std::string mesh_type;
+    // output backend: none, mpiio, mpiio_async, adios or adios_async
+    std::string writer;
+    // MPI-IO hints passed to MPI_File_open, e.g. cb_nodes, striping_factor
+    std::map<std::string, std::string> mpiio_hints;
+    // "none": one shared file, "node": one subfile per compute node,
+    // "ratio": one subfile per mpiio_ranks_per_subfile processes
+    std::string mpiio_subfiling;
+    int mpiio_ranks_per_subfile;
+    // record the I/O pattern into this JSON file for gray-scott-replay
+    std::string trace;
 
     Settings();
     static Settings from_json(const std::string &fname);
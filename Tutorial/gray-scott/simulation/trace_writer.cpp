@@ -0,0 +1,143 @@
+#include "trace_writer.h"
+
+#include <fstream>
+#include <iostream>
+
+#include "json.hpp"
+
+TraceWriter::TraceWriter(std::unique_ptr<Writer> writer,
+                         const Settings &settings, const GrayScott &sim,
+                         MPI_Comm comm)
+: writer(std::move(writer)), settings(settings), comm(comm)
+{
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nproc);
+
+    unsigned long long block[6] = {sim.offset_z, sim.offset_y, sim.offset_x,
+                                   sim.size_z,   sim.size_y,   sim.size_x};
+    if (!rank)
+    {
+        blocks.resize(6 * nproc);
+    }
+    MPI_Gather(block, 6, MPI_UNSIGNED_LONG_LONG, blocks.data(), 6,
+               MPI_UNSIGNED_LONG_LONG, 0, comm);
+}
+
+void TraceWriter::open(const std::string &fname)
+{
+    double t0 = MPI_Wtime();
+    writer->open(fname);
+    time_open = MPI_Wtime() - t0;
+    compute = 0.0;
+    steps.clear();
+    time_compute.clear();
+    time_write.clear();
+    checkpoint_steps.clear();
+    time_checkpoint.clear();
+}
+
+void TraceWriter::write(int step, const GrayScott &sim)
+{
+    double t0 = MPI_Wtime();
+    writer->write(step, sim);
+    double t1 = MPI_Wtime();
+
+    steps.push_back(step);
+    time_compute.push_back(compute);
+    time_write.push_back(t1 - t0);
+    compute = 0.0;
+}
+
+void TraceWriter::checkpoint(int step, double seconds)
+{
+    checkpoint_steps.push_back(step);
+    time_checkpoint.push_back(seconds);
+}
+
+void TraceWriter::close()
+{
+    double t0 = MPI_Wtime();
+    writer->close();
+    time_close = MPI_Wtime() - t0;
+
+    /* the slowest process determines the cadence */
+    const int nsteps = static_cast<int>(steps.size());
+    const int ncheckpoints = static_cast<int>(checkpoint_steps.size());
+    std::vector<double> compute(nsteps), write(nsteps),
+        checkpoint(ncheckpoints);
+    double t[2] = {time_open, time_close}, tmax[2];
+    MPI_Reduce(time_compute.data(), compute.data(), nsteps, MPI_DOUBLE,
+               MPI_MAX, 0, comm);
+    MPI_Reduce(time_write.data(), write.data(), nsteps, MPI_DOUBLE, MPI_MAX,
+               0, comm);
+    MPI_Reduce(time_checkpoint.data(), checkpoint.data(), ncheckpoints,
+               MPI_DOUBLE, MPI_MAX, 0, comm);
+    MPI_Reduce(t, tmax, 2, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (rank)
+    {
+        return;
+    }
+
+    nlohmann::json start = nlohmann::json::array();
+    nlohmann::json count = nlohmann::json::array();
+    for (int i = 0; i < nproc; ++i)
+    {
+        start.push_back({blocks[6 * i], blocks[6 * i + 1], blocks[6 * i + 2]});
+        count.push_back(
+            {blocks[6 * i + 3], blocks[6 * i + 4], blocks[6 * i + 5]});
+    }
+    nlohmann::json shape = {settings.L, settings.L, settings.L};
+
+    nlohmann::json variables = nlohmann::json::array();
+    for (const auto &v : writer->variables())
+    {
+        nlohmann::json var = {{"name", v.name}, {"type", v.type}};
+        if (v.array)
+        {
+            var["shape"] = shape;
+            var["start"] = start;
+            var["count"] = count;
+        }
+        variables.push_back(var);
+    }
+    nlohmann::json attributes = nlohmann::json::array();
+    for (const auto &a : writer->attributes())
+    {
+        nlohmann::json attr = {{"name", a.name}, {"type", a.type}};
+        if (a.type == "double")
+        {
+            attr["value"] = std::stod(a.value);
+        }
+        else
+        {
+            attr["value"] = a.value;
+        }
+        attributes.push_back(attr);
+    }
+
+    nlohmann::json j;
+    j["version"] = 1;
+    j["writer"] = settings.writer;
+    j["nprocs"] = nproc;
+    j["variables"] = variables;
+    j["attributes"] = attributes;
+    j["open"] = tmax[0];
+    j["close"] = tmax[1];
+    j["steps"] = {{"step", steps}, {"compute", compute}, {"write", write}};
+    j["checkpoints"] = {{"step", checkpoint_steps}, {"write", checkpoint}};
+
+    std::ofstream ofs(settings.trace);
+    ofs << j.dump() << std::endl;
+    if (!ofs)
+    {
+        std::cerr << "ERROR: could not write I/O trace " << settings.trace
+                  << std::endl;
+    }
+}
+
+void TraceWriter::print_settings()
+{
+    writer->print_settings();
+    std::cout << "  recording the I/O pattern into " << settings.trace
+              << std::endl;
+}
@@ -0,0 +1,64 @@
+#ifndef __TRACE_WRITER_H__
+#define __TRACE_WRITER_H__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include "writer.h"
+
+/*
+ * Records the I/O pattern of the simulation while passing all calls to the
+ * actual backend: the variables and attributes the backend defines, the
+ * selection of every process, and per output step the time spent computing
+ * before the step (given by computed()) and the time spent in the writer.
+ * Checkpoints written outside the backend are recorded with checkpoint().
+ * The trace is written as JSON by rank 0 at close, and gray-scott-replay
+ * writes the same pattern without running the simulation.
+ */
+class TraceWriter : public Writer
+{
+public:
+    TraceWriter(std::unique_ptr<Writer> writer, const Settings &settings,
+                const GrayScott &sim, MPI_Comm comm);
+    void open(const std::string &fname) override;
+    void write(int step, const GrayScott &sim) override;
+    void close() override;
+    void print_settings() override;
+    std::vector<OutputItem> variables() const override
+    {
+        return writer->variables();
+    }
+    std::vector<OutputItem> attributes() const override
+    {
+        return writer->attributes();
+    }
+
+    // seconds of computation before the next output step
+    void computed(double seconds) { compute += seconds; }
+
+    // seconds spent writing a checkpoint at step
+    void checkpoint(int step, double seconds);
+
+protected:
+    std::unique_ptr<Writer> writer;
+    Settings settings;
+    MPI_Comm comm;
+    int rank, nproc;
+
+    // start and count (z, y, x) of the block of every process, on rank 0
+    std::vector<unsigned long long> blocks;
+
+    double time_open;
+    double time_close;
+    double compute = 0.0; // since the previous output step
+    std::vector<int> steps;
+    std::vector<double> time_compute;
+    std::vector<double> time_write;
+    std::vector<int> checkpoint_steps;
+    std::vector<double> time_checkpoint;
+};
+
+#endif
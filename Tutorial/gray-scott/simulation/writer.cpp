@@ -1,19 +1,27 @@
 #include "writer.h"
+#include "writer_mpiio.h"
 
-void define_bpvtk_attribute(const Settings &s, adios2::IO &io)
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+/*
+ * VTK ImageData schema of U and V for mesh_type image
+ */
+std::string bpvtk_image(const Settings &s)
 {
-    auto lf_VTKImage = [](const Settings &s, adios2::IO &io) {
-        const std::string extent = "0 " + std::to_string(s.L) + " " + "0 " +
-                                   std::to_string(s.L) + " " + "0 " +
-                                   std::to_string(s.L);
+    const std::string extent = "0 " + std::to_string(s.L) + " " + "0 " +
+                               std::to_string(s.L) + " " + "0 " +
+                               std::to_string(s.L);
 
-        const std::string imageData = R"(
+    const std::string imageData = R"(
         <?xml version="1.0"?>
         <VTKFile type="ImageData" version="0.1" byte_order="LittleEndian">
           <ImageData WholeExtent=")" + extent +
-                                      R"(" Origin="0 0 0" Spacing="1 1 1">
+                                  R"(" Origin="0 0 0" Spacing="1 1 1">
             <Piece Extent=")" + extent +
-                                      R"(">
+                                  R"(">
               <CellData Scalars="U">
                   <DataArray Name="U" />
                   <DataArray Name="V" />
@@ -24,13 +32,14 @@ void define_bpvtk_attribute(const Settings &s, adios2::IO &io)
             </Piece>
           </ImageData>
         </VTKFile>)";
+    return imageData;
+}
 
-        io.DefineAttribute<std::string>("vtk.xml", imageData);
-    };
-
+void define_bpvtk_attribute(const Settings &s, adios2::IO &io)
+{
     if (s.mesh_type == "image")
     {
-        lf_VTKImage(s, io);
+        io.DefineAttribute<std::string>("vtk.xml", bpvtk_image(s));
     }
     else if (s.mesh_type == "structured")
     {
@@ -41,9 +50,69 @@ void define_bpvtk_attribute(const Settings &s, adios2::IO &io)
     // TODO extend to other formats e.g. structured
 }
 
-Writer::Writer(const Settings &settings, const GrayScott &sim, adios2::IO io)
-: settings(settings), io(io)
+std::unique_ptr<Writer> make_writer(const std::string &type,
+                                    const Settings &settings,
+                                    const GrayScott &sim, adios2::IO io,
+                                    MPI_Comm comm)
+{
+    if (type == "none")
+    {
+        return std::unique_ptr<Writer>(new NullWriter());
+    }
+    else if (type == "mpiio" || type == "mpiio_async")
+    {
+        return std::unique_ptr<Writer>(
+            new MPIIOWriter(settings, sim, comm, type == "mpiio_async"));
+    }
+    else if (type == "adios" || type == "adios_async")
+    {
+        return std::unique_ptr<Writer>(
+            new ADIOSWriter(settings, sim, io, type == "adios_async"));
+    }
+    throw std::invalid_argument(
+        "ERROR: writer=" + type +
+        " is not supported in settings.json, use none, mpiio, mpiio_async, "
+        "adios or adios_async\n");
+}
+
+std::vector<OutputItem> simulation_variables()
+{
+    return {{"U", "double", true, ""},
+            {"V", "double", true, ""},
+            {"step", "int32_t", false, ""}};
+}
+
+std::vector<OutputItem> simulation_attributes(const Settings &settings)
+{
+    const std::pair<const char *, double> params[] = {
+        {"F", settings.F},   {"k", settings.k},   {"dt", settings.dt},
+        {"Du", settings.Du}, {"Dv", settings.Dv}, {"noise", settings.noise}};
+    std::vector<OutputItem> attrs;
+    for (const auto &p : params)
+    {
+        std::ostringstream value;
+        value.precision(std::numeric_limits<double>::max_digits10);
+        value << p.second;
+        attrs.push_back({p.first, "double", false, value.str()});
+    }
+    return attrs;
+}
+
+void NullWriter::print_settings()
+{
+    std::cout << "Simulation writes data using engine type:              "
+              << "none (no output)" << std::endl;
+}
+
+ADIOSWriter::ADIOSWriter(const Settings &settings, const GrayScott &sim,
+                         adios2::IO io, bool async)
+: settings(settings), async(async), io(io)
 {
+    if (async)
+    {
+        io.SetParameter("AsyncWrite", "true");
+    }
+
     io.DefineAttribute<double>("F", settings.F);
     io.DefineAttribute<double>("k", settings.k);
     io.DefineAttribute<double>("dt", settings.dt);
@@ -77,12 +146,12 @@ Writer::Writer(const Settings &settings, const GrayScott &sim, adios2::IO io)
     var_step = io.DefineVariable<int>("step");
 }
 
-void Writer::open(const std::string &fname)
+void ADIOSWriter::open(const std::string &fname)
 {
     writer = io.Open(fname, adios2::Mode::Write);
 }
 
-void Writer::write(int step, const GrayScott &sim)
+void ADIOSWriter::write(int step, const GrayScott &sim)
 {
     if (!sim.size_x || !sim.size_y || !sim.size_z)
     {
@@ -131,4 +200,26 @@ void Writer::write(int step, const GrayScott &sim)
     }
 }
 
-void Writer::close() { writer.Close(); }
+void ADIOSWriter::close() { writer.Close(); }
+
+void ADIOSWriter::print_settings()
+{
+    std::cout << "Simulation writes data using engine type:              "
+              << io.EngineType() << (async ? " (AsyncWrite)" : "")
+              << std::endl;
+}
+
+std::vector<OutputItem> ADIOSWriter::variables() const
+{
+    return simulation_variables();
+}
+
+std::vector<OutputItem> ADIOSWriter::attributes() const
+{
+    std::vector<OutputItem> attrs = simulation_attributes(settings);
+    if (settings.mesh_type == "image")
+    {
+        attrs.push_back({"vtk.xml", "string", false, bpvtk_image(settings)});
+    }
+    return attrs;
+}
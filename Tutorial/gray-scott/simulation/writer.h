@@ -1,22 +1,79 @@
 #ifndef __WRITER_H__
 #define __WRITER_H__
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <adios2.h>
 #include <mpi.h>
 
 #include "gray-scott.h"
 #include "settings.h"
 
+/*
+ * A variable or an attribute of the output, as recorded in the I/O trace.
+ * Arrays are the global L x L x L grid, written in blocks by all processes.
+ */
+struct OutputItem
+{
+    std::string name;
+    std::string type; // double, int32_t or string
+    bool array;
+    std::string value; // of an attribute
+};
+
+/*
+ * Output backend of the simulation, selected with "writer" in settings.json
+ */
 class Writer
 {
 public:
-    Writer(const Settings &settings, const GrayScott &sim, adios2::IO io);
-    void open(const std::string &fname);
-    void write(int step, const GrayScott &sim);
-    void close();
+    virtual ~Writer() {}
+    virtual void open(const std::string &fname) = 0;
+    virtual void write(int step, const GrayScott &sim) = 0;
+    virtual void close() = 0;
+
+    // called on rank 0 after open
+    virtual void print_settings() = 0;
+
+    // what the backend defines, for the I/O trace
+    virtual std::vector<OutputItem> variables() const { return {}; }
+    virtual std::vector<OutputItem> attributes() const { return {}; }
+};
+
+/*
+ * No output, to measure the simulation alone
+ */
+class NullWriter : public Writer
+{
+public:
+    void open(const std::string &) override {}
+    void write(int, const GrayScott &) override {}
+    void close() override {}
+    void print_settings() override;
+};
+
+/*
+ * ADIOS output, engine and parameters come from the adios2.xml config.
+ * With async, the BP5 engine writes a step in the background while the
+ * simulation computes the next steps (AsyncWrite parameter).
+ */
+class ADIOSWriter : public Writer
+{
+public:
+    ADIOSWriter(const Settings &settings, const GrayScott &sim, adios2::IO io,
+                bool async = false);
+    void open(const std::string &fname) override;
+    void write(int step, const GrayScott &sim) override;
+    void close() override;
+    void print_settings() override;
+    std::vector<OutputItem> variables() const override;
+    std::vector<OutputItem> attributes() const override;
 
 protected:
     Settings settings;
+    bool async;
 
     adios2::IO io;
     adios2::Engine writer;
@@ -25,4 +82,24 @@ protected:
     adios2::Variable<int> var_step;
 };
 
+/*
+ * U, V and step, written by the ADIOS and MPI-IO backends
+ */
+std::vector<OutputItem> simulation_variables();
+
+/*
+ * The parameters of the simulation (F, k, dt, Du, Dv, noise) as double
+ * attributes
+ */
+std::vector<OutputItem> simulation_attributes(const Settings &settings);
+
+/*
+ * Create the backend of the given type: none, mpiio, mpiio_async, adios or
+ * adios_async. The MPI-IO backends use comm, the ADIOS backends use io.
+ */
+std::unique_ptr<Writer> make_writer(const std::string &type,
+                                    const Settings &settings,
+                                    const GrayScott &sim, adios2::IO io,
+                                    MPI_Comm comm);
+
 #endif
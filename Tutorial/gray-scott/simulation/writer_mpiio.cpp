@@ -0,0 +1,536 @@
+#include "writer_mpiio.h"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+/* MPI counts are int, larger buffers are written in pieces of this many
+ * doubles */
+static const uint64_t max_count = uint64_t(1) << 30;
+
+#define CHECK_ERR(func)                                                        \
+    {                                                                          \
+        if (err != MPI_SUCCESS)                                                \
+        {                                                                      \
+            int errorStringLen;                                                \
+            char errorString[MPI_MAX_ERROR_STRING];                            \
+            MPI_Error_string(err, errorString, &errorStringLen);               \
+            printf("Error at line %d: calling %s (%s)\n", __LINE__, #func,     \
+                   errorString);                                               \
+        }                                                                      \
+    }
+
+MPIIOWriter::MPIIOWriter(const Settings &settings, const GrayScott &sim,
+                         const MPI_Comm comm, bool nonblocking)
+: settings(settings), nonblocking(nonblocking), comm(comm)
+{
+    /*
+     *  MPI Subarray data type for writing/reading parallel distributed arrays
+     *  See case II for array with ghost cells:
+     *  https://wgropp.cs.illinois.edu/courses/cs598-s15/lectures/lecture33.pdf
+     */
+
+    /*
+     *  One step in the file is U followed by V, so the file type is a 4D
+     *  subarray where the slowest dimension selects the variable
+     */
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nproc);
+
+    int fshape[4] = {gsfile::num_vars, (int)settings.L, (int)settings.L,
+                     (int)settings.L};
+    int fstart[4] = {0, (int)sim.offset_z, (int)sim.offset_y,
+                     (int)sim.offset_x};
+    int fcount[4] = {gsfile::num_vars, (int)sim.size_z, (int)sim.size_y,
+                     (int)sim.size_x};
+    err = MPI_Type_create_subarray(4, fshape, fcount, fstart, MPI_ORDER_C,
+                                   MPI_DOUBLE, &filetype);
+    CHECK_ERR(MPI_Type_create_subarray for file type)
+    err = MPI_Type_commit(&filetype);
+    CHECK_ERR(MPI_Type_commit for file type)
+
+    buf.resize(gsfile::num_vars * sim.size_z * sim.size_y * sim.size_x);
+    if (buf.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+        throw std::invalid_argument(
+            "ERROR: the local block of a process is too large for MPI-IO, "
+            "use more processes\n");
+    }
+
+    gsfile::init_header(hdr, settings.L);
+    hdr.F = settings.F;
+    hdr.k = settings.k;
+    hdr.dt = settings.dt;
+    hdr.Du = settings.Du;
+    hdr.Dv = settings.Dv;
+    hdr.noise = settings.noise;
+
+
+    subfiling = (settings.mpiio_subfiling != "none");
+    if (subfiling)
+    {
+        init_subfiling(sim);
+    }
+}
+
+void MPIIOWriter::init_subfiling(const GrayScott &sim)
+{
+    /* group processes by compute node or by a fixed ratio */
+    if (settings.mpiio_subfiling == "node")
+    {
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL,
+                            &group_comm);
+    }
+    else if (settings.mpiio_subfiling == "ratio")
+    {
+        if (settings.mpiio_ranks_per_subfile < 1)
+        {
+            throw std::invalid_argument(
+                "ERROR: mpiio_ranks_per_subfile must be at least 1 in "
+                "settings.json\n");
+        }
+        MPI_Comm_split(comm, rank / settings.mpiio_ranks_per_subfile, rank,
+                       &group_comm);
+    }
+    else
+    {
+        throw std::invalid_argument(
+            "ERROR: mpiio_subfiling=" + settings.mpiio_subfiling +
+            " is not supported in settings.json, use none, node or ratio\n");
+    }
+    MPI_Comm_rank(group_comm, &group_rank);
+    MPI_Comm_size(group_comm, &group_size);
+
+    /* subfile id is the rank of the aggregator among all aggregators */
+    MPI_Comm agg_comm;
+    int nsubfiles = 0;
+    subfile = 0;
+    MPI_Comm_split(comm, group_rank ? MPI_UNDEFINED : 0, rank, &agg_comm);
+    if (!group_rank)
+    {
+        MPI_Comm_rank(agg_comm, &subfile);
+        MPI_Comm_size(agg_comm, &nsubfiles);
+        MPI_Comm_free(&agg_comm);
+    }
+    MPI_Bcast(&subfile, 1, MPI_INT, 0, group_comm);
+    MPI_Bcast(&nsubfiles, 1, MPI_INT, 0, comm);
+
+    /* layout of a record in the subfile: blocks in group rank order; a
+     * group can hold more than 2^31 doubles, so offsets are 64 bit */
+    int mycount = static_cast<int>(buf.size());
+    group_counts.resize(group_size);
+    MPI_Allgather(&mycount, 1, MPI_INT, group_counts.data(), 1, MPI_INT,
+                  group_comm);
+    group_displs.resize(group_size);
+    uint64_t total = 0;
+    for (int i = 0; i < group_size; ++i)
+    {
+        group_displs[i] = total;
+        total += group_counts[i];
+    }
+    subfile_stride = total * sizeof(double);
+    if (!group_rank)
+    {
+        group_buf.resize(total);
+    }
+
+    gsfile::block_entry b;
+    b.subfile = static_cast<uint64_t>(subfile);
+    b.offset = group_displs[group_rank] * sizeof(double);
+    b.stride = subfile_stride;
+    b.start[0] = sim.offset_z;
+    b.start[1] = sim.offset_y;
+    b.start[2] = sim.offset_x;
+    b.count[0] = sim.size_z;
+    b.count[1] = sim.size_y;
+    b.count[2] = sim.size_x;
+    if (!rank)
+    {
+        blocks.resize(nproc);
+    }
+    MPI_Gather(&b, sizeof(b), MPI_BYTE, blocks.data(), sizeof(b), MPI_BYTE, 0,
+               comm);
+
+    hdr.nsubfiles = static_cast<uint64_t>(nsubfiles);
+    hdr.nblocks = static_cast<uint64_t>(nproc);
+    hdr.blocks_offset = sizeof(gsfile::header);
+}
+
+void MPIIOWriter::open(const std::string &fname)
+{
+    int cmode;
+    MPI_Offset headersize = sizeof(gsfile::header);
+    double t0 = MPI_Wtime();
+
+    /* set file open mode */
+    cmode = MPI_MODE_CREATE;  /* to create a new file */
+    cmode |= MPI_MODE_WRONLY; /* with write-only permission */
+
+    /* remove an existing file from an earlier run so that striping hints
+     * take effect on the new file */
+    const std::string &s = fname;
+    if (!rank)
+    {
+        MPI_File_delete(s.c_str(), MPI_INFO_NULL);
+    }
+    if (subfiling && !group_rank)
+    {
+        MPI_File_delete(gsfile::subfile_name(s, subfile).c_str(),
+                        MPI_INFO_NULL);
+    }
+    MPI_Barrier(comm);
+
+    /* Users can set customized I/O hints in settings.json, the info is freed
+     * once the file is open */
+    MPI_Info info = MPI_INFO_NULL; /* no user I/O hint */
+    if (!settings.mpiio_hints.empty())
+    {
+        MPI_Info_create(&info);
+        for (const auto &hint : settings.mpiio_hints)
+        {
+            MPI_Info_set(info, hint.first.c_str(), hint.second.c_str());
+        }
+    }
+
+    nsteps = 0;
+    index.clear();
+    time_write = 0.0;
+    time_wait = 0.0;
+    time_close = 0.0;
+
+    if (subfiling)
+    {
+        /* metadata file is only written by rank 0 */
+        if (!rank)
+        {
+            MPI_Status status;
+            err = MPI_File_open(MPI_COMM_SELF, s.c_str(), cmode, MPI_INFO_NULL,
+                                &fh);
+            CHECK_ERR(MPI_File_open metadata file)
+            err = MPI_File_write_at(fh, 0, &hdr, sizeof(hdr), MPI_BYTE,
+                                    &status);
+            CHECK_ERR(MPI_File_write_at header)
+            err = MPI_File_write_at(
+                fh, hdr.blocks_offset, blocks.data(),
+                (int)(blocks.size() * sizeof(gsfile::block_entry)), MPI_BYTE,
+                &status);
+            CHECK_ERR(MPI_File_write_at blocks)
+        }
+        /* each aggregator opens its own subfile */
+        if (!group_rank)
+        {
+            std::string sname = gsfile::subfile_name(s, subfile);
+            err = MPI_File_open(MPI_COMM_SELF, sname.c_str(), cmode, info,
+                                &sfh);
+            CHECK_ERR(MPI_File_open subfile)
+        }
+        if (info != MPI_INFO_NULL)
+        {
+            MPI_Info_free(&info);
+        }
+        MPI_Barrier(comm);
+        time_open = MPI_Wtime() - t0;
+        return;
+    }
+
+    /* collectively open a file, shared by all processes in MPI_COMM_WORLD */
+    err = MPI_File_open(comm, s.c_str(), cmode, info, &fh);
+    CHECK_ERR(MPI_File_open to write)
+
+    /* header without index, it is rewritten at close */
+    if (!rank)
+    {
+        MPI_Status status;
+        err = MPI_File_write_at(fh, 0, &hdr, sizeof(hdr), MPI_BYTE, &status);
+        CHECK_ERR(MPI_File_write_at header)
+    }
+
+    err =
+        MPI_File_set_view(fh, headersize, MPI_DOUBLE, filetype, "native", info);
+    CHECK_ERR(MPI_File_set_view)
+    if (info != MPI_INFO_NULL)
+    {
+        MPI_Info_free(&info);
+    }
+    MPI_Barrier(comm);
+    time_open = MPI_Wtime() - t0;
+}
+
+void MPIIOWriter::write(int step, const GrayScott &sim)
+{
+    double t0 = MPI_Wtime();
+
+    /* the buffer is still in use by the write of the previous step */
+    wait_requests();
+    double t1 = MPI_Wtime();
+
+    /* sim.u_ghost() provides access to the U variable as is */
+    /* sim.u_noghost() provides a contiguous copy without the ghost cells */
+    const size_t nelem = sim.size_z * sim.size_y * sim.size_x;
+    sim.u_noghost(buf.data());
+    sim.v_noghost(buf.data() + nelem);
+
+    /* local min/max of U and V for the step index */
+    double mins[gsfile::num_vars];
+    double maxs[gsfile::num_vars];
+    for (int i = 0; i < gsfile::num_vars; ++i)
+    {
+        double vmin = std::numeric_limits<double>::max();
+        double vmax = std::numeric_limits<double>::lowest();
+        for (size_t j = i * nelem; j < (i + 1) * nelem; ++j)
+        {
+            vmin = std::min(vmin, buf[j]);
+            vmax = std::max(vmax, buf[j]);
+        }
+        mins[i] = vmin;
+        maxs[i] = vmax;
+    }
+
+    if (subfiling)
+    {
+        write_subfile();
+    }
+    else
+    {
+        write_shared();
+    }
+
+    gsfile::index_entry e;
+    MPI_Reduce(mins, e.min, gsfile::num_vars, MPI_DOUBLE, MPI_MIN, 0, comm);
+    MPI_Reduce(maxs, e.max, gsfile::num_vars, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (!rank)
+    {
+        e.step = static_cast<uint64_t>(step);
+        if (subfiling)
+        {
+            e.offset = nsteps;
+        }
+        else
+        {
+            e.offset =
+                sizeof(gsfile::header) + nsteps * gsfile::step_size(hdr);
+        }
+        index.push_back(e);
+    }
+    ++nsteps;
+
+    double t2 = MPI_Wtime();
+    time_wait += t1 - t0;
+    time_write += t2 - t0;
+
+    /* a non-blocking step is only posted here, its write completes later,
+     * so there is no bandwidth to report */
+    double t[3] = {t2 - t0, t1 - t0, t2 - t1}, tmax[3];
+    MPI_Reduce(t, tmax, 3, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (!rank)
+    {
+        double mb = gsfile::step_size(hdr) / 1048576.0;
+        std::cout << "Writer step " << nsteps - 1 << ": " << mb << " MB";
+        if (nonblocking)
+        {
+            std::cout << ", waited " << tmax[1]
+                      << " s for the previous step, posted in " << tmax[2]
+                      << " s";
+        }
+        else
+        {
+            std::cout << " in " << tmax[0] << " s (" << mb / tmax[0]
+                      << " MB/s)";
+        }
+        std::cout << std::endl;
+    }
+}
+
+void MPIIOWriter::write_shared()
+{
+    MPI_Status status;
+
+    /* offset is counted in visible elements of the file view */
+    MPI_Offset offset = static_cast<MPI_Offset>(nsteps * buf.size());
+    if (nonblocking)
+    {
+        /* completes while the simulation computes the next steps */
+        requests.push_back(MPI_REQUEST_NULL);
+        err = MPI_File_iwrite_at_all(fh, offset, buf.data(), (int)buf.size(),
+                                     MPI_DOUBLE, &requests.back());
+        CHECK_ERR(MPI_File_iwrite_at_all)
+    }
+    else
+    {
+        err = MPI_File_write_at_all(fh, offset, buf.data(), (int)buf.size(),
+                                    MPI_DOUBLE, &status);
+        CHECK_ERR(MPI_File_write_at_all)
+    }
+}
+
+void MPIIOWriter::write_subfile()
+{
+    MPI_Status status;
+
+    /* the aggregator collects the blocks of its group in group rank order;
+     * like MPI_Gatherv, but the displacements do not fit an int */
+    if (group_rank)
+    {
+        err = MPI_Send(buf.data(), (int)buf.size(), MPI_DOUBLE, 0, 0,
+                       group_comm);
+        CHECK_ERR(MPI_Send to aggregator)
+        return;
+    }
+    std::vector<MPI_Request> recvs(group_size - 1);
+    for (int i = 1; i < group_size; ++i)
+    {
+        err = MPI_Irecv(group_buf.data() + group_displs[i], group_counts[i],
+                        MPI_DOUBLE, i, 0, group_comm, &recvs[i - 1]);
+        CHECK_ERR(MPI_Irecv from group)
+    }
+    std::copy(buf.begin(), buf.end(), group_buf.begin());
+    err = MPI_Waitall(group_size - 1, recvs.data(), MPI_STATUSES_IGNORE);
+    CHECK_ERR(MPI_Waitall for group)
+
+    /* one record per step in the subfile, independent of other groups */
+    MPI_Offset offset = static_cast<MPI_Offset>(nsteps * subfile_stride);
+    for (uint64_t pos = 0; pos < group_buf.size(); pos += max_count)
+    {
+        int count = static_cast<int>(
+            std::min<uint64_t>(max_count, group_buf.size() - pos));
+        MPI_Offset at = offset + pos * sizeof(double);
+        if (nonblocking)
+        {
+            requests.push_back(MPI_REQUEST_NULL);
+            err = MPI_File_iwrite_at(sfh, at, group_buf.data() + pos, count,
+                                     MPI_DOUBLE, &requests.back());
+            CHECK_ERR(MPI_File_iwrite_at subfile)
+        }
+        else
+        {
+            err = MPI_File_write_at(sfh, at, group_buf.data() + pos, count,
+                                    MPI_DOUBLE, &status);
+            CHECK_ERR(MPI_File_write_at subfile)
+        }
+    }
+}
+
+void MPIIOWriter::wait_requests()
+{
+    if (!requests.empty())
+    {
+        err = MPI_Waitall(static_cast<int>(requests.size()), requests.data(),
+                          MPI_STATUSES_IGNORE);
+        CHECK_ERR(MPI_Waitall)
+        requests.clear();
+    }
+}
+
+void MPIIOWriter::close()
+{
+    double t0 = MPI_Wtime();
+
+    wait_requests();
+
+    if (subfiling)
+    {
+        if (!group_rank)
+        {
+            err = MPI_File_close(&sfh);
+            CHECK_ERR(MPI_File_close subfile);
+        }
+    }
+    else
+    {
+        /* switch back to a byte view to append the index and update the
+         * header */
+        err = MPI_File_set_view(fh, 0, MPI_BYTE, MPI_BYTE, "native",
+                                MPI_INFO_NULL);
+        CHECK_ERR(MPI_File_set_view for index)
+    }
+
+    if (!rank)
+    {
+        MPI_Status status;
+        hdr.nsteps = nsteps;
+        if (subfiling)
+        {
+            hdr.index_offset = hdr.blocks_offset +
+                               hdr.nblocks * sizeof(gsfile::block_entry);
+        }
+        else
+        {
+            hdr.index_offset =
+                sizeof(gsfile::header) + nsteps * gsfile::step_size(hdr);
+        }
+        err = MPI_File_write_at(
+            fh, hdr.index_offset, index.data(),
+            (int)(index.size() * sizeof(gsfile::index_entry)), MPI_BYTE,
+            &status);
+        CHECK_ERR(MPI_File_write_at index)
+        err = MPI_File_write_at(fh, 0, &hdr, sizeof(hdr), MPI_BYTE, &status);
+        CHECK_ERR(MPI_File_write_at header)
+    }
+
+    /* collectively close the file (only rank 0 has the metadata file open
+     * with subfiling) */
+    if (!subfiling || !rank)
+    {
+        err = MPI_File_close(&fh);
+        CHECK_ERR(MPI_File_close);
+    }
+    MPI_Barrier(comm);
+    time_close = MPI_Wtime() - t0;
+
+    /* timing summary, slowest process counts */
+    double t[4] = {time_open, time_write, time_wait, time_close}, tmax[4];
+    MPI_Reduce(t, tmax, 4, MPI_DOUBLE, MPI_MAX, 0, comm);
+    if (!rank)
+    {
+        double mb = nsteps * gsfile::step_size(hdr) / 1048576.0;
+        double total = tmax[0] + tmax[1] + tmax[3];
+        std::cout << "========================================" << std::endl;
+        std::cout << "MPI-IO output:    " << nsteps << " steps, " << mb
+                  << " MB" << std::endl;
+        std::cout << "open time:        " << tmax[0] << " s" << std::endl;
+        std::cout << "write time:       " << tmax[1] << " s" << std::endl;
+        if (nonblocking)
+        {
+            std::cout << "  waiting:        " << tmax[2] << " s" << std::endl;
+        }
+        std::cout << "close time:       " << tmax[3] << " s" << std::endl;
+        std::cout << "I/O bandwidth:    " << mb / total
+                  << " MB/s (as seen by the simulation)" << std::endl;
+        std::cout << "========================================" << std::endl;
+    }
+}
+
+void MPIIOWriter::print_settings()
+{
+    std::cout << "Simulation writes data using engine type:              "
+              << "native MPI-IO"
+              << (nonblocking ? " (non-blocking)" : "")
+              << std::endl;
+
+    if (subfiling)
+    {
+        std::cout << "  subfiling by " << settings.mpiio_subfiling << ": "
+                  << hdr.nsubfiles << " subfiles, " << group_size
+                  << " processes in the group of rank 0" << std::endl;
+    }
+
+    /* hints actually used by the MPI-IO implementation */
+    if (!settings.mpiio_hints.empty())
+    {
+        MPI_Info used;
+        MPI_File_get_info(subfiling ? sfh : fh, &used);
+        for (const auto &hint : settings.mpiio_hints)
+        {
+            char value[MPI_MAX_INFO_VAL + 1];
+            int flag;
+            MPI_Info_get(used, hint.first.c_str(), MPI_MAX_INFO_VAL, value,
+                         &flag);
+            std::cout << "  MPI-IO hint " << hint.first << " = "
+                      << hint.second << " (in effect: "
+                      << (flag ? value : "not supported") << ")" << std::endl;
+        }
+        MPI_Info_free(&used);
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef __WRITER_MPIIO_H__
+#define __WRITER_MPIIO_H__
+
+#include <mpi.h>
+
+#include <vector>
+
+#include "../common/gsfile.h"
+#include "writer.h"
+
+/*
+ * Native MPI-IO output into a gsfile (see common/gsfile.h), either one
+ * shared file written collectively or subfiles written by aggregators.
+ * With nonblocking, the write of a step overlaps the next computation.
+ */
+class MPIIOWriter : public Writer
+{
+public:
+    MPIIOWriter(const Settings &settings, const GrayScott &sim,
+                const MPI_Comm comm, bool nonblocking = false);
+    void open(const std::string &fname) override;
+    void write(int step, const GrayScott &sim) override;
+    void close() override;
+    void print_settings() override;
+
+    // the parameters are in the header of the file
+    std::vector<OutputItem> variables() const override
+    {
+        return simulation_variables();
+    }
+    std::vector<OutputItem> attributes() const override
+    {
+        return simulation_attributes(settings);
+    }
+
+protected:
+    Settings settings;
+    bool nonblocking;
+    MPI_Comm comm;
+    int nproc, rank;
+    int err;
+    MPI_File fh;
+    MPI_Datatype filetype;
+
+    // pending non-blocking writes of the previous step
+    std::vector<MPI_Request> requests;
+
+    // timing of the I/O as seen by the simulation (seconds, this rank)
+    double time_open;
+    double time_write; // total time spent in write()
+    double time_wait;  // part of time_write waiting for the previous step
+    double time_close;
+
+    // U and V of the local block without ghost cells, one after the other
+    std::vector<double> buf;
+    uint64_t nsteps;
+
+    // file header and step index, maintained on rank 0
+    gsfile::header hdr;
+    std::vector<gsfile::index_entry> index;
+
+    // subfiling: the first process of each group (aggregator) gathers the
+    // blocks of the group and writes them into its own subfile
+    bool subfiling;
+    MPI_Comm group_comm;
+    int group_rank, group_size;
+    int subfile;                    // id of the subfile of the group
+    MPI_File sfh;                   // subfile, on aggregators
+    std::vector<int> group_counts;       // on aggregators
+    std::vector<uint64_t> group_displs;  // on aggregators
+    std::vector<double> group_buf;  // on aggregators
+    uint64_t subfile_stride;        // bytes of one step in the subfile
+    std::vector<gsfile::block_entry> blocks; // on rank 0
+
+    void init_subfiling(const GrayScott &sim);
+    void write_shared();
+    void write_subfile();
+    void wait_requests();
+};
+
+#endif
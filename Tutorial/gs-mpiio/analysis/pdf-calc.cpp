@@ -19,6 +19,8 @@
 
 #include <mpi.h>
 
+#include "gsfile.h"
+
 bool epsilon(double d) { return (d < 1.0e-20); }
 bool epsilon(float d) { return (d < 1.0e-20); }
 
@@ -101,12 +103,15 @@ void compute_pdf(const std::vector<T> &data,
 void printUsage()
 {
     std::cout
-        << "Usage: pdf_calc input output [N] [output_inputdata]\n"
+        << "Usage: pdf_calc input output [N] [output_inputdata] [step_start] "
+           "[step_count]\n"
         << "  input:   Name of the input file handle for reading data\n"
         << "  output:  Name of the output file to which data must be written\n"
         << "  N:       Number of bins for the PDF calculation, default = 1000\n"
         << "  output_inputdata: YES will write the original variables besides "
-           "the analysis results\n\n";
+           "the analysis results\n"
+        << "  step_start: First step to process, default = 0\n"
+        << "  step_count: Number of steps to process, default = all\n\n";
 }
 
 #define CHECK_ERR(func)                                                        \
@@ -121,13 +126,6 @@ void printUsage()
         }                                                                      \
     }
 
-struct header_in
-{
-    unsigned long long z;
-    unsigned long long y;
-    unsigned long long x;
-};
-
 struct header_pdf
 {
     unsigned long long nslices;
@@ -182,6 +180,17 @@ int main(int argc, char *argv[])
             write_inputvars = true;
     }
 
+    size_t step_start = 0;
+    size_t step_count = 0; // 0 = all steps
+    if (argc >= 6)
+    {
+        step_start = static_cast<size_t>(std::stoul(argv[5]));
+    }
+    if (argc >= 7)
+    {
+        step_count = static_cast<size_t>(std::stoul(argv[6]));
+    }
+
     std::size_t u_global_size;
     std::size_t u_local_size;
     size_t count1;
@@ -193,10 +202,10 @@ int main(int argc, char *argv[])
     std::vector<double> pdf_u;  // output data
     std::vector<double> bins_u; // output data
 
-    // Process header
-    struct header_in hdr;
+    // Process header and step index
+    gsfile::header hdr;
+    std::vector<gsfile::index_entry> index;
     int nsteps;
-    size_t varsize;
     int mode = MPI_MODE_RDONLY;
     MPI_Info info = MPI_INFO_NULL;
     MPI_Status status;
@@ -206,26 +215,58 @@ int main(int argc, char *argv[])
     CHECK_ERR(MPI_File_open input)
     if (!rank)
     {
-        MPI_Offset filesize;
-        err = MPI_File_get_size(fin, &filesize);
-        CHECK_ERR(MPI_File_get_size)
-        err = MPI_File_read(fin, &hdr, sizeof(hdr), MPI_BYTE, &status);
+        err = MPI_File_read_at(fin, 0, &hdr, sizeof(hdr), MPI_BYTE, &status);
         CHECK_ERR(MPI_File_read header)
-        size_t nelems = hdr.z * hdr.y * hdr.x;
-        varsize = nelems * sizeof(double);
-        double nsteps_d = (filesize - sizeof(hdr)) / (varsize * 1.0);
-        nsteps = (int)nsteps_d;
-        if ((double)nsteps != nsteps_d)
+        if (!gsfile::check_header(hdr))
+        {
+            std::cerr << "ERROR " << in_filename
+                      << " is not a gray-scott MPI-IO file" << std::endl;
+            MPI_Abort(comm, -1);
+        }
+        if (!hdr.index_offset)
         {
-            std::cerr << "ERROR file size " << filesize << " is unexpected. "
+            std::cerr << "ERROR " << in_filename
+                      << " has no step index, it was not closed properly"
                       << std::endl;
+            MPI_Abort(comm, -1);
         }
-        std::cout << "Found " << nsteps << " steps in file, size of U is "
+        index.resize(hdr.nsteps);
+        err = MPI_File_read_at(fin, hdr.index_offset, index.data(),
+                               (int)(hdr.nsteps * sizeof(gsfile::index_entry)),
+                               MPI_BYTE, &status);
+        CHECK_ERR(MPI_File_read index)
+        std::cout << "Found " << hdr.nsteps << " steps in file, size of U is "
                   << hdr.z << "x" << hdr.y << "x" << hdr.x << std::endl;
     }
     MPI_Bcast(&hdr, sizeof(hdr), MPI_BYTE, 0, comm);
-    MPI_Bcast(&nsteps, 1, MPI_INT, 0, comm);
-    MPI_Bcast(&varsize, 1, MPI_INT, 0, comm);
+    index.resize(hdr.nsteps);
+    MPI_Bcast(index.data(), (int)(hdr.nsteps * sizeof(gsfile::index_entry)),
+              MPI_BYTE, 0, comm);
+
+    // Block table of a subfiled output, maps the writers' blocks to subfiles
+    std::vector<gsfile::block_entry> blocks(hdr.nblocks);
+    if (hdr.nsubfiles && !rank)
+    {
+        err = MPI_File_read_at(fin, hdr.blocks_offset, blocks.data(),
+                               (int)(hdr.nblocks * sizeof(gsfile::block_entry)),
+                               MPI_BYTE, &status);
+        CHECK_ERR(MPI_File_read blocks)
+        std::cout << "Data is in " << hdr.nsubfiles << " subfiles, written by "
+                  << hdr.nblocks << " processes" << std::endl;
+    }
+    MPI_Bcast(blocks.data(), (int)(hdr.nblocks * sizeof(gsfile::block_entry)),
+              MPI_BYTE, 0, comm);
+
+    // steps to process
+    if (step_start > hdr.nsteps)
+    {
+        step_start = hdr.nsteps;
+    }
+    if (!step_count || step_start + step_count > hdr.nsteps)
+    {
+        step_count = hdr.nsteps - step_start;
+    }
+    nsteps = static_cast<int>(step_count);
 
     std::vector<std::size_t> shape;
     shape.push_back(hdr.z);
@@ -259,9 +300,52 @@ int main(int argc, char *argv[])
     err = MPI_Type_commit(&typeInU);
     CHECK_ERR(MPI_Type_commit for input file type)
 
-    err = MPI_File_set_view(fin, sizeof(header_in), MPI_DOUBLE, typeInU,
-                            "native", info);
-    CHECK_ERR(MPI_File_set_view)
+    // subfiled output: read the z-range of each block that overlaps the
+    // slab, from the subfile holding the block, into its place in u
+    struct block_read
+    {
+        uint64_t subfile;
+        MPI_Offset offset; // of the z-range within a record of the subfile
+        uint64_t stride;
+        int nelems;
+        MPI_Datatype memtype;
+    };
+    std::vector<block_read> block_reads;
+    std::vector<MPI_File> subfiles(hdr.nsubfiles, MPI_FILE_NULL);
+    for (const auto &b : blocks)
+    {
+        size_t zs = std::max(start1, static_cast<size_t>(b.start[0]));
+        size_t ze = std::min(start1 + count1,
+                             static_cast<size_t>(b.start[0] + b.count[0]));
+        if (zs >= ze)
+        {
+            continue;
+        }
+        block_read r;
+        r.subfile = b.subfile;
+        r.offset = static_cast<MPI_Offset>(
+            b.offset + (zs - b.start[0]) * b.count[1] * b.count[2] *
+                           sizeof(double));
+        r.stride = b.stride;
+        r.nelems = static_cast<int>((ze - zs) * b.count[1] * b.count[2]);
+        int mshape[3] = {(int)count1, (int)shape[1], (int)shape[2]};
+        int mstart[3] = {(int)(zs - start1), (int)b.start[1], (int)b.start[2]};
+        int mcount[3] = {(int)(ze - zs), (int)b.count[1], (int)b.count[2]};
+        err = MPI_Type_create_subarray(3, mshape, mcount, mstart, MPI_ORDER_C,
+                                       MPI_DOUBLE, &r.memtype);
+        CHECK_ERR(MPI_Type_create_subarray for block memory type)
+        err = MPI_Type_commit(&r.memtype);
+        CHECK_ERR(MPI_Type_commit for block memory type)
+        block_reads.push_back(r);
+
+        if (subfiles[b.subfile] == MPI_FILE_NULL)
+        {
+            std::string sname = gsfile::subfile_name(in_filename, b.subfile);
+            err = MPI_File_open(MPI_COMM_SELF, sname.c_str(), mode, info,
+                                &subfiles[b.subfile]);
+            CHECK_ERR(MPI_File_open subfile)
+        }
+    }
 
     // define datatype for writing parallel arrays (PDF)
     MPI_Datatype typeOutPDF;
@@ -310,20 +394,38 @@ int main(int argc, char *argv[])
     // read data step-by-step
     for (int step = 0; step < nsteps; ++step)
     {
-        err = MPI_File_read_all(fin, u.data(), mynelems, MPI_DOUBLE, &status);
-        CHECK_ERR(MPI_File_read_all)
+        // seek to the step using the index, U is the first variable
+        const gsfile::index_entry &e = index[step_start + step];
+        if (hdr.nsubfiles)
+        {
+            // e.offset is the record of the step in the subfiles
+            for (const auto &r : block_reads)
+            {
+                err = MPI_File_read_at(subfiles[r.subfile],
+                                       e.offset * r.stride + r.offset,
+                                       u.data(), 1, r.memtype, &status);
+                CHECK_ERR(MPI_File_read_at subfile)
+            }
+        }
+        else
+        {
+            err = MPI_File_set_view(fin, e.offset, MPI_DOUBLE, typeInU,
+                                    "native", info);
+            CHECK_ERR(MPI_File_set_view)
+            err = MPI_File_read_all(fin, u.data(), mynelems, MPI_DOUBLE,
+                                    &status);
+            CHECK_ERR(MPI_File_read_all)
+        }
 
         if (!rank)
         {
-            std::cout << "PDF Analysis step " << step << std::endl;
+            std::cout << "PDF Analysis step " << step
+                      << " processing sim output step " << step_start + step
+                      << " sim compute step " << e.step << std::endl;
         }
 
-        // Calculate min/max of arrays
-        std::pair<double, double> minmax_u;
-        auto mmu = std::minmax_element(u.begin(), u.end());
-        minmax_u = std::make_pair(*mmu.first, *mmu.second);
-        /*std::cout << "Rank " << rank << " min = " << *mmu.first
-                  << " max = " << *mmu.second << "\n";*/
+        // Global min/max of U in this step is stored in the index
+        std::pair<double, double> minmax_u = std::make_pair(e.min[0], e.max[0]);
 
         // Compute PDF
         std::vector<double> pdf_u;
@@ -348,6 +450,18 @@ int main(int argc, char *argv[])
     // cleanup (close reader and writer)
     err = MPI_File_close(&fin);
     CHECK_ERR(MPI_File_close input)
+    for (auto &f : subfiles)
+    {
+        if (f != MPI_FILE_NULL)
+        {
+            err = MPI_File_close(&f);
+            CHECK_ERR(MPI_File_close subfile)
+        }
+    }
+    for (auto &r : block_reads)
+    {
+        MPI_Type_free(&r.memtype);
+    }
     err = MPI_File_close(&fpdf);
     CHECK_ERR(MPI_File_close output PDF)
     if (!rank)
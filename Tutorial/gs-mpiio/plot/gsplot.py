@@ -4,7 +4,7 @@ import argparse
 import numpy as np
 import matplotlib.pyplot as plt
 import matplotlib.gridspec as gridspec
-from os import fstat
+import struct
 #import time
 #import os
 
@@ -70,11 +70,60 @@ def read_data(args, fr, step, start_coord, size_dims):
     return data
 
 
+def read_header(fr):
+    # see ../gray-scott/common/gsfile.h
+    # magic, version, z, y, x, nvars, varnames, nsteps, index_offset,
+    # nsubfiles, nblocks, blocks_offset, params
+    fmt = "8sQQQQQ16sQQQQQ6d"
+    fields = struct.unpack(fmt, fr.read(struct.calcsize(fmt)))
+    if fields[0].rstrip(b"\0") != b"GSMPIIO":
+        raise ValueError("not a gray-scott MPI-IO file")
+    shape3 = np.array(fields[2:5], dtype=np.uint64)
+    varnames = [fields[6][i:i+8].rstrip(b"\0").decode()
+                for i in range(0, 8*fields[5], 8)]
+    nsteps = fields[7]
+    index_offset = fields[8]
+    if index_offset == 0:
+        raise ValueError("file has no step index, it was not closed properly")
+    subfiling = fields[9:12]
+    return shape3, varnames, nsteps, index_offset, subfiling
+
+
+def read_blocks(fr, nblocks, blocks_offset):
+    # subfile, offset, stride, start[3], count[3]
+    dt = np.dtype([("subfile", np.uint64), ("offset", np.uint64),
+                   ("stride", np.uint64), ("start", np.uint64, 3),
+                   ("count", np.uint64, 3)])
+    fr.seek(blocks_offset)
+    return np.fromfile(fr, dtype=dt, count=nblocks)
+
+
+def read_subfiled(subfiles, blocks, record, varid, shape3):
+    # assemble the global array of one variable from the blocks
+    u = np.empty((int(shape3[0]), int(shape3[1]), int(shape3[2])))
+    for b in blocks:
+        start = [int(v) for v in b["start"]]
+        count = [int(v) for v in b["count"]]
+        nelems = count[0]*count[1]*count[2]
+        sf = subfiles[int(b["subfile"])]
+        sf.seek(record*int(b["stride"]) + int(b["offset"]) + varid*nelems*8)
+        u[start[0]:start[0]+count[0], start[1]:start[1]+count[1],
+          start[2]:start[2]+count[2]] = np.fromfile(
+            sf, dtype=np.float64, count=nelems).reshape(count)
+    return u
+
+
+def read_index(fr, nsteps, nvars, index_offset):
+    # step, offset, min[nvars], max[nvars]
+    dt = np.dtype([("step", np.uint64), ("offset", np.uint64),
+                   ("min", np.float64, nvars), ("max", np.float64, nvars)])
+    fr.seek(index_offset)
+    return np.fromfile(fr, dtype=dt, count=nsteps)
+
+
 if __name__ == "__main__":
     # fontsize on plot
     fontsize = 24
-    # header size in bytes in data file
-    headersize = 24
 
     args = SetupArgs()
 #    print(args)
@@ -82,29 +131,38 @@ if __name__ == "__main__":
     # Read the data from this object
     print("open {0}...".format(args.instream))
     fr = open(args.instream, "rb")
-    fileSize = fstat(fr.fileno()).st_size
-    header = fr.read(headersize)
-    shape3 = np.frombuffer(header, dtype=np.uint64, count=3, offset=0)
-    print("size of U = {0}x{1}x{2}".format(shape3[0], shape3[1], shape3[2]))
+    shape3, varnames, nsteps, index_offset, subfiling = read_header(fr)
+    print("size of {0} = {1}x{2}x{3}".format(
+        "/".join(varnames), shape3[0], shape3[1], shape3[2]))
+    print("found {0} steps".format(nsteps))
+    index = read_index(fr, nsteps, len(varnames), index_offset)
 
+    nsubfiles, nblocks, blocks_offset = subfiling
+    subfiles = []
+    if nsubfiles > 0:
+        print("data is in {0} subfiles".format(nsubfiles))
+        blocks = read_blocks(fr, nblocks, blocks_offset)
+        subfiles = [open("{0}.{1}".format(args.instream, i), "rb")
+                    for i in range(nsubfiles)]
+
+    varid = varnames.index(args.varname)
     nelems = (int)(shape3[0]*shape3[1]*shape3[2])
     varsize = nelems*8
-    nsteps_d = (fileSize-headersize)/varsize
-    nsteps = (int)(nsteps_d)
-    if ((np.float64)(nsteps) != (np.float64)(nsteps_d)):
-        print("ERROR: file size {0} is unexpected".format(fileSize))
-    print("found {0} steps".format(nsteps))
 
     # Read through the steps, one at a time
     for step in range(0, nsteps):
-        print("GS Plot step {0}".format(step), flush=True)
-
-        start_offset = headersize + step*varsize
-        # print("read {0} elems ({1} bytes) from offset {2}".format(
-        #     nelems, nelems*8, start_offset))
-        u = np.fromfile(fr, dtype=np.float64,
-                        count=nelems).reshape(
-            shape3[0], shape3[1], shape3[2])
+        print("GS Plot step {0} sim step {1} min = {2} max = {3}".format(
+            step, index[step]["step"], index[step]["min"][varid],
+            index[step]["max"][varid]), flush=True)
+
+        if nsubfiles > 0:
+            u = read_subfiled(subfiles, blocks, int(index[step]["offset"]),
+                              varid, shape3)
+        else:
+            fr.seek(int(index[step]["offset"]) + varid*varsize)
+            u = np.fromfile(fr, dtype=np.float64,
+                            count=nelems).reshape(
+                shape3[0], shape3[1], shape3[2])
 
         if args.plane in ('xy', 'all'):
             data = u[:, :, int(shape3[2]/2)]
@@ -118,4 +176,6 @@ if __name__ == "__main__":
             data = u[int(shape3[0]/2), :, :]
             Plot2D('yz',  data, args, shape3, step, fontsize)
 
+    for sf in subfiles:
+        sf.close()
     fr.close()
@@ -20,9 +20,8 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
-#include <chrono>
-#include <thread>
 
+#include "../../../gray-scott/common/step_wait.hpp"
 #include "AnalysisSettings.h"
 
 void printUsage()
@@ -31,7 +30,13 @@ void printUsage()
               << "  input:   name of input data file/stream\n"
               << "  output:  name of output data file/stream\n"
               << "  N:       number of processes in X dimension\n"
-              << "  M:       number of processes in Y dimension\n\n";
+              << "  M:       number of processes in Y dimension\n"
+              << "  --wait=I[:M[:F[:G]]]  optional, BeginStep timeout starts "
+                 "at I seconds\n"
+              << "           and grows by F up to M while the next step is not "
+                 "ready,\n"
+              << "           give up after G seconds, default = 0.1:10:2:-1 "
+                 "(never)\n\n";
 }
 
 void Compute(const std::vector<double> &Tin, std::vector<double> &Tout,
@@ -84,7 +89,19 @@ int main(int argc, char *argv[])
 
     try
     {
-        AnalysisSettings settings(argc, argv, rank, nproc);
+        // --wait=... can be anywhere, the rest are the positional arguments
+        WaitPolicy waitPolicy;
+        std::vector<char *> args;
+        for (int i = 0; i < argc; i++)
+        {
+            if (!i || !parse_wait_option(argv[i], waitPolicy))
+            {
+                args.push_back(argv[i]);
+            }
+        }
+
+        AnalysisSettings settings(static_cast<int>(args.size()), args.data(),
+                                  rank, nproc);
         adios2::ADIOS ad(settings.configfile, mpiReaderComm, adios2::DebugON);
 
         // Define IO method for engine creation
@@ -111,18 +128,12 @@ int main(int argc, char *argv[])
         adios2::Engine writer;
         bool firstStep = true;
         int step = 0;
+        StepWaiter waiter(waitPolicy, mpiReaderComm);
 
         while (true)
         {
-            adios2::StepStatus status =
-                reader.BeginStep(adios2::StepMode::Read, 10.0f);
-            if (status == adios2::StepStatus::NotReady)
-            {
-                // std::cout << "Stream not ready yet. Waiting...\n";
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-                continue;
-            }
-            else if (status != adios2::StepStatus::OK)
+            adios2::StepStatus status = waiter.begin_step(reader);
+            if (status != adios2::StepStatus::OK)
             {
                 break;
             }
@@ -188,7 +199,8 @@ int main(int argc, char *argv[])
             {
                 std::cout << "Analysis step " << step
                           << " processing simulation step "
-                          << reader.CurrentStep() << std::endl;
+                          << reader.CurrentStep() << ", waited "
+                          << waiter.last_wait() << " s" << std::endl;
             }
 
             /* Compute dT from current T (Tin) and previous T (Tout)
@@ -207,6 +219,10 @@ int main(int argc, char *argv[])
         }
         reader.Close();
         writer.Close();
+        if (!rank)
+        {
+            waiter.print_summary(std::cout, "Analysis");
+        }
     }
     catch (std::invalid_argument &e) // command-line argument errors
     {
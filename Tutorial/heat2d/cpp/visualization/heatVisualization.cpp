@@ -14,10 +14,9 @@
 #include <stdexcept>
 #include <string>
 #include <vector>
-#include <chrono>
-#include <thread>
 #include <numeric>
 
+#include "../../../gray-scott/common/step_wait.hpp"
 #include "VizOutput.h"
 #include "VizSettings.h"
 
@@ -29,7 +28,12 @@ void printUsage()
               << "  min    : lowest value for the colortable\n"
               << "  max    : highest value for the colortable\n"
               << "  height : output image width in pixels\n"
-              << "  width  : output image height in pixels\n\n";
+              << "  width  : output image height in pixels\n"
+              << "  --wait=I[:M[:F[:G]]] : BeginStep timeout starts at I "
+                 "seconds and grows\n"
+              << "           by F up to M while the next step is not ready, "
+                 "give up after\n"
+              << "           G seconds, default = 0.1:10:2:-1 (never)\n\n";
 }
 
 int main(int argc, char *argv[])
@@ -59,7 +63,19 @@ int main(int argc, char *argv[])
     {
         try
         {
-            VizSettings settings(argc, argv);
+            // --wait=... can be anywhere, the rest are the positional
+            // arguments
+            WaitPolicy waitPolicy;
+            std::vector<char *> args;
+            for (int i = 0; i < argc; i++)
+            {
+                if (!i || !parse_wait_option(argv[i], waitPolicy))
+                {
+                    args.push_back(argv[i]);
+                }
+            }
+
+            VizSettings settings(static_cast<int>(args.size()), args.data());
             adios2::ADIOS ad(settings.configfile, MPI_COMM_SELF,
                              adios2::DebugON);
 
@@ -80,19 +96,12 @@ int main(int argc, char *argv[])
             adios2::Variable<double> vTin;
             bool firstStep = true;
             int step = 0;
+            StepWaiter waiter(waitPolicy);
 
             while (true)
             {
-                adios2::StepStatus status =
-                    reader.BeginStep(adios2::StepMode::Read, 10.0f);
-                if (status == adios2::StepStatus::NotReady)
-                {
-                    // std::cout << "Stream not ready yet. Waiting...\n";
-                    std::this_thread::sleep_for(
-                        std::chrono::milliseconds(1000));
-                    continue;
-                }
-                else if (status != adios2::StepStatus::OK)
+                adios2::StepStatus status = waiter.begin_step(reader);
+                if (status != adios2::StepStatus::OK)
                 {
                     break;
                 }
@@ -133,7 +142,8 @@ int main(int argc, char *argv[])
 
                 std::cout << "Visualization step " << step
                           << " processing analysis step "
-                          << reader.CurrentStep() << std::endl;
+                          << reader.CurrentStep() << ", waited "
+                          << waiter.last_wait() << " s" << std::endl;
 
                 /* Plot or print T */
                 OutputVariable(vTin, Tin, settings, reader.CurrentStep());
@@ -142,6 +152,7 @@ int main(int argc, char *argv[])
                 firstStep = false;
             }
             reader.Close();
+            waiter.print_summary(std::cout, "Visualization");
         }
         catch (std::invalid_argument &e) // command-line argument errors
         {